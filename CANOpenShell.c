@@ -51,14 +51,17 @@
 #include "file_parser.h"
 #include "utils.h"
 #include "smartmotor_table.h"
+#include "interp_pdo.h"
+#include "fifo_control.h"
+#include "interp_feeder.h"
+#include "motion_limit.h"
+#include "sdo_stats.h"
 
 //****************************************************************************
 // DEFINES
 
-#define MOTOR_INDEX_FIRST 0x77
-#define INTERPOLATION_DATA_INDEX_OFFSET 6
 #define INTERPOLATION_START_INDEX_OFFSET 12
-#define TARGET_POSITION_INDEX_OFFSET 13
+#define MOTOR_RPDO_PER_SLOT 3 // PDO di ricezione del master per ogni motore: stato, posizione, stato CAN
 
 #ifdef CBRN
 #define POSITION_FIFO_FILE "/tmp/cbrn_spinitalia_pos_stream_pipe"
@@ -70,6 +73,11 @@
 
 #define SYNC_DIVIDER_STATUS 15
 #define SYNC_DIVIDER_TIMESTAMP 100
+#define TABLE_CLOSE_TIMEOUT_MS 1000 // attesa della chiusura della tabella oltre ai punti nella FIFO
+#define PROGRAM_UPLOAD_POLL_MS 10 // attesa tra due letture dello stato del motore durante l'upload
+#define SIMULATION_SEEK_TOLERANCE 100 // distanza in passi encoder dal primo punto entro cui CT4 T<ms> non riposiziona il motore
+#define SIMULATION_SEEK_VELOCITY 300000 // velocità del riposizionamento di CT4 T<ms>, come per CT2 P2
+#define SIMULATION_SEEK_ACCELERATION 10 // accelerazione del riposizionamento di CT4 T<ms>
 
 /* Macro */
 #undef max
@@ -130,6 +138,8 @@
  *
  *              CT4
  * CENTRATO --------------> SIMULAZIONE
+ *        CT4 T<ms>, motori lontani dal primo punto
+ * CENTRATO ----------------------------------------> CENTRAGGIO
  *            CT1 Mx Px VMx AMx
  * CENTRATO ---------------------> IN_POSIZIONE
  *             CT2 P3
@@ -161,6 +171,8 @@
  *
  *               fine
  * CENTRAGGIO -----------> CENTRATO
+ *          fine dopo CT4 T<ms>
+ * CENTRAGGIO ---------------------> SIMULAZIONE
  *
  *
  *             CT5 && centrato
@@ -220,11 +232,13 @@ static volatile int quit_flag = 0;
 pthread_mutex_t robot_state_mux = PTHREAD_MUTEX_INITIALIZER
 ;
 volatile int simulation_ready[TABLE_MAX_NUM];
+static long simulation_seek_ms = 0; // CT4 T<ms> in attesa del riposizionamento, protetto da robot_state_mux
 
 void CheckReadRaw(CO_Data* d, UNS8 nodeid);
 void CheckReadStringRaw(CO_Data* d, UNS8 nodeid);
 void CheckWriteRaw(CO_Data* d, UNS8 nodeid);
 int SmartWriteRaw(CO_Data* d, UNS8 nodeid);
+int SmartProgramUpload(CO_Data* d, UNS8 nodeid);
 
 void CheckWriteProgramDownload(CO_Data* d, UNS8 nodeid);
 void CheckWriteProgramUpload(CO_Data* d, UNS8 nodeid);
@@ -234,11 +248,16 @@ UNS32 OnInterpUpdate(CO_Data* d, UNS8 nodeid);
 int SmartStop(UNS8 nodeid, int from_callback);
 void SimulationTableUpdate(CO_Data* d, UNS8 nodeid, UNS16 interpolation_status, int point_number,
     int from_callback);
+void SimulationFeed(UNS8 nodeid, UNS16 interp_status);
 void SimulationTableEnd(CO_Data* d, UNS8 nodeId, int machine_state,
 UNS32 return_value);
 int MotorTableIndexFromNodeId(UNS8 nodeId);
+int MotorSlotCount(CO_Data* d);
 void SmartRelease(UNS8 nodeid, int from_callback, int brake);
 void SimulationTableStart(CO_Data* d);
+void SimulationStartSkewReport(void);
+int SimulationStart(UNS8 nodeid, long start_time_ms, int from_callback);
+void SimulationTableCloseCheck(CO_Data* d);
 void SmartStopCallback(CO_Data* d, UNS8 nodeId, int machine_state, int is_register,
 UNS32 return_value);
 void SmartPosition(UNS8 nodeid, long position, long velocity, long acceleration, int start,
@@ -247,6 +266,7 @@ void CANOpenShellOD_post_sync(CO_Data* d);
 void closing();
 void Exit(CO_Data* d, UNS32 nodeid);
 void RawCmdMotor(char* sdo);
+void SdoStatsPrint(char* sdo);
 
 //****************************************************************************
 // GLOBALS
@@ -263,7 +283,6 @@ static timer_t fake_update_timer;
 
 pthread_t pipe_handler;
 pthread_t pipe_write_handler;
-pthread_mutex_t interpolator_mux[CANOPEN_NODE_NUMBER];
 pthread_mutex_t position_mux = PTHREAD_MUTEX_INITIALIZER
 ;
 pthread_cond_t position_ready = PTHREAD_COND_INITIALIZER
@@ -278,7 +297,6 @@ char motor_position_write[CANOPEN_NODE_NUMBER]; /**< di chi ho già segnato la p
 //static struct timeval position_start_time;
 struct timespec position_start_time;
 
-volatile int interpolator_busy[CANOPEN_NODE_NUMBER];
 UNS8 raw_response[33];
 int raw_response_flag = -1;
 UNS32 raw_response_size = 0;
@@ -296,11 +314,21 @@ int machine_state = -1;
 struct table_data motor_table[TABLE_MAX_NUM + 1]; // numero di elementi pari al numero dei motori più l'elemento di broadcast
 
 static int simulation_first_start[CANOPEN_NODE_NUMBER];
+static struct timespec simulation_start_request; /**< invio del comando di start */
+static struct timespec motor_start_time[CANOPEN_NODE_NUMBER]; /**< arrivo dello stato con l'interpolazione avviata */
+static int motor_start_seen[CANOPEN_NODE_NUMBER]; /**< il motore ha segnalato l'avvio */
+static int start_skew_pending = 0; /**< lo scarto tra gli avvii non è ancora stato riportato */
+static int table_close_pending[CANOPEN_NODE_NUMBER]; /**< punto di chiusura inviato, in attesa di conferma */
+static struct timespec table_close_deadline[CANOPEN_NODE_NUMBER]; /**< oltre questo istante la tabella viene chiusa con l'SDO */
+static long table_close_position[CANOPEN_NODE_NUMBER]; /**< posizione finale della tabella */
+static long interp_last_position[CANOPEN_NODE_NUMBER]; /**< ultimo punto scritto nell'interpolatore (simulazione senza motori) */
 static int can_error[CANOPEN_NODE_NUMBER];
 
 FILE *position_fp = NULL;
 
 int fake_flag = 0;
+int mmap_flag = 0;
+int sync_start_flag = 0; /**< lo start dell'interpolazione viene eseguito da tutti i motori al SYNC */
 int exit_from_limit_complete = 0;
 int release_complete = 0;
 int homing_executed = 0;
@@ -363,10 +391,6 @@ void SmartClear(UNS8 nodeid)
     int motor_index;
     for(motor_index = 0; motor_index < motor_active_number; motor_index++)
     {
-      pthread_mutex_lock(&interpolator_mux[motor_table[motor_index].nodeId]);
-      interpolator_busy[motor_table[motor_index].nodeId] = 0;
-      pthread_mutex_unlock(&interpolator_mux[motor_table[motor_index].nodeId]);
-
       simulation_first_start[motor_table[motor_index].nodeId] = 1;
 
       motor_started[motor_table[motor_index].nodeId] = 0;
@@ -376,10 +400,6 @@ void SmartClear(UNS8 nodeid)
   {
     if(motor_active[nodeid])
     {
-      pthread_mutex_lock(&interpolator_mux[nodeid]);
-      interpolator_busy[nodeid] = 0;
-      pthread_mutex_unlock(&interpolator_mux[nodeid]);
-
       simulation_first_start[nodeid] = 1;
 
       motor_started[nodeid] = 0;
@@ -544,11 +564,10 @@ UNS32 return_value)
 
      QueueLast(&motor_table[motor_table_index], &data_read);
 
-     InterpolationTimePeriod[nodeId - MOTOR_INDEX_FIRST] = 0;
-     InterpolationTimeValue[nodeId - MOTOR_INDEX_FIRST] = 0;
-     InterpolationData[nodeId - MOTOR_INDEX_FIRST] = data_read.position;
+     interp_last_position[nodeId] = data_read.position;
 
-     sendPDOevent(d);
+     if(fake_flag == 0)
+       interp_send(nodeId, data_read.position, 0, 0);
      }
 
      pthread_mutex_unlock(&robot_state_mux);
@@ -651,6 +670,73 @@ int MotorTableIndexFromNodeId(UNS8 nodeId)
   return -1;
 }
 
+/**
+ * Numero di motori gestibili: il minore tra le tabelle disponibili ed i
+ * gruppi di PDO di ricezione presenti nel dizionario del master.
+ */
+int MotorSlotCount(CO_Data* d)
+{
+  int rpdo_count = d->lastIndex->PDO_RCV - d->firstIndex->PDO_RCV + 1;
+
+  if((rpdo_count / MOTOR_RPDO_PER_SLOT) < TABLE_MAX_NUM)
+    return rpdo_count / MOTOR_RPDO_PER_SLOT;
+
+  return TABLE_MAX_NUM;
+}
+
+/**
+ * Cerca una tabella libera tra quelle gestibili.
+ *
+ * @return: indice della tabella, -1 se sono tutte occupate
+ *
+ * @remark: una tabella rimane del motore a cui è stata assegnata anche se
+ * questo viene disattivato, per cui non basta contare i motori attivi.
+ */
+static int MotorSlotFree(CO_Data* d)
+{
+  int i;
+
+  for(i = 0; i < MotorSlotCount(d); i++)
+  {
+    if(motor_table[i].nodeId == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/**
+ * Associa al motore i PDO di ricezione del master relativi alla sua tabella.
+ *
+ * @input slot: indice della tabella assegnata al motore
+ *
+ * @return:  0 -> PDO associati
+ *          -1 -> indice non valido
+ *
+ * @remark: i PDO di ricezione del dizionario sono divisi in tre gruppi uguali
+ * (stato 0x180, posizione 0x280, stato CAN 0x380): al motore va il PDO di
+ * indice slot di ogni gruppo, a cui viene scritto il COB-ID corrispondente
+ * al suo indirizzo. Per questo i motori possono avere indirizzi qualsiasi e
+ * per aumentarne il numero basta aggiungere PDO di ricezione al dizionario.
+ */
+static int MotorSlotAssign(CO_Data* d, int slot, UNS8 nodeid)
+{
+  int group_size = (d->lastIndex->PDO_RCV - d->firstIndex->PDO_RCV + 1) / MOTOR_RPDO_PER_SLOT;
+  UNS32 cob_id_base[MOTOR_RPDO_PER_SLOT] =
+  { 0x180, 0x280, 0x380 };
+  int group;
+
+  // fuori dai gruppi scriverei i PDO di un altro motore o gli oggetti vicini
+  if((slot < 0) || (slot >= MotorSlotCount(d)))
+    return -1;
+
+  for(group = 0; group < MOTOR_RPDO_PER_SLOT; group++)
+    *(UNS32 *) d->objdict[d->firstIndex->PDO_RCV + group * group_size + slot].pSubindex[1].pObject =
+        cob_id_base[group] + nodeid;
+
+  return 0;
+}
+
 void SmartPositionTargetCallback(CO_Data* d, UNS8 nodeid, int machine_state, int is_register,
 UNS32 return_value)
 {
@@ -672,7 +758,18 @@ UNS32 return_value)
     pthread_mutex_unlock(&exit_from_limit_mux);
 
     pthread_mutex_lock(&robot_state_mux);
-    if((robot_state == RICERCA_CENTRO) || (robot_state == CENTRAGGIO))
+    if((robot_state == CENTRAGGIO) && (simulation_seek_ms > 0))
+    {
+      long start_time_ms = simulation_seek_ms;
+
+      // i motori sono sul primo punto di CT4 T<ms>: parte la simulazione
+      simulation_seek_ms = 0;
+      robot_state = CENTRATO;
+      pthread_mutex_unlock(&robot_state_mux);
+
+      SimulationStart(0, start_time_ms, 1);
+    }
+    else if((robot_state == RICERCA_CENTRO) || (robot_state == CENTRAGGIO))
     {
       if(robot_state == RICERCA_CENTRO)
         homing_executed = 1;
@@ -723,7 +820,9 @@ UNS32 return_value)
   &smart_message_machine
   };
 
-  _machine_exe(d, nodeId, &OnCanStatusReset, fault_machine, 1, 1, 2, strlen("ZS"), "ZS");
+  uintptr_t args[] = { strlen("ZS"), (uintptr_t) "ZS" };
+
+  _machine_exe(d, nodeId, &OnCanStatusReset, fault_machine, 1, 1, 2, args);
   /*struct state_machine_struct *fault_machine[] =
   {
   &smart_reset_statusword_machine
@@ -744,7 +843,9 @@ UNS32 return_value)
       &smart_read_machine
       };
 
-      _machine_exe(d, nodeId, &OnSDORead, fault_machine, 1, 1, 3, 0x2500, 0x02, visible_string);
+      uintptr_t args[] = { 0x2500, 0x02, visible_string };
+
+      _machine_exe(d, nodeId, &OnSDORead, fault_machine, 1, 1, 3, args);
 
       return;
     }
@@ -763,7 +864,9 @@ UNS32 return_value)
   &smart_read_machine
   };
 
-  _machine_exe(d, nodeId, &OnSDOWrite, fault_machine, 1, 1, 3, 0x2500, 0x03, 0);
+  uintptr_t args[] = { 0x2500, 0x03, 0 };
+
+  _machine_exe(d, nodeId, &OnSDOWrite, fault_machine, 1, 1, 3, args);
 
 }
 
@@ -780,7 +883,9 @@ UNS32 return_value)
       &smart_read_machine
       };
 
-      _machine_exe(d, nodeId, &OnSDOCheck, fault_machine, 1, 1, 3, 0x2500, 0x03, 0);
+      uintptr_t args[] = { 0x2500, 0x03, 0 };
+
+      _machine_exe(d, nodeId, &OnSDOCheck, fault_machine, 1, 1, 3, args);
 
       return;
     }
@@ -792,7 +897,9 @@ UNS32 return_value)
       };
 
       sprintf(sdo_request, "RCAN");
-      _machine_exe(d, nodeId, &OnSDOWrite, fault_machine, 1, 1, 2, strlen(sdo_request), sdo_request);
+      uintptr_t args[] = { strlen(sdo_request), (uintptr_t) sdo_request };
+
+      _machine_exe(d, nodeId, &OnSDOWrite, fault_machine, 1, 1, 2, args);
     }
   }
   else
@@ -825,7 +932,9 @@ UNS32 OnCanStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSu
       &smart_read_machine
       };
 
-      _machine_exe(d, nodeid, &OnSDOCheck, fault_machine, 1, 1, 3, 0x2500, 0x03, 0);
+      uintptr_t args[] = { 0x2500, 0x03, 0 };
+
+      _machine_exe(d, nodeid, &OnSDOCheck, fault_machine, 1, 1, 3, args);
     }
   }
 
@@ -950,7 +1059,7 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
         &smart_stop_machine
         };
 
-        _machine_exe(d, nodeid, &SmartBusVoltageCallback, origin_machine, 1, 1, 0);
+        _machine_exe(d, nodeid, &SmartBusVoltageCallback, origin_machine, 1, 1, 0, NULL);
       }
       else
       {
@@ -988,7 +1097,7 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
           struct state_machine_struct *machine = &smart_stop_machine;
 
           _machine_exe(CANOpenShellOD_Data, nodeid, &SmartPositionTargetCallback, &machine, 1, 1,
-              0);
+              0, NULL);
         }
         else
         {
@@ -1027,7 +1136,7 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
           &smart_stop_machine
           };
 
-          _machine_exe(d, nodeid, &SmartFaultCallback, stop_machine, 1, 1, 0);
+          _machine_exe(d, nodeid, &SmartFaultCallback, stop_machine, 1, 1, 0, NULL);
         }
         else
         {
@@ -1056,8 +1165,9 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
         &smart_limit_enable_machine, &smart_position_set_machine, &smart_position_start_machine
         };
 
-        _machine_exe(CANOpenShellOD_Data, nodeid, NULL, origin_machine, 3, 1, 4, 10, 10,
-            motor_table[motor_table_index].backward_velocity, 0);
+        uintptr_t args[] = { 10, 10, motor_table[motor_table_index].backward_velocity, 0 };
+
+        _machine_exe(CANOpenShellOD_Data, nodeid, NULL, origin_machine, 3, 1, 4, args);
       }
     }
   }
@@ -1093,7 +1203,7 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
         };
 
         // invia il comando di stop A TUTTI
-        _machine_exe(d, 0, &SmartFaultCallback, fault_machine, 1, 1, 0/*1, 0x1*/);
+        _machine_exe(d, 0, &SmartFaultCallback, fault_machine, 1, 1, 0/*1, 0x1*/, NULL);
       }
       else
       {
@@ -1102,7 +1212,7 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
         {
           motor_interp_status[nodeid] = 0x122d;
 
-          motor_position[nodeid] = InterpolationData[nodeid - MOTOR_INDEX_FIRST];
+          motor_position[nodeid] = interp_last_position[nodeid];
         }
 
         pthread_mutex_unlock(&robot_state_mux);
@@ -1129,7 +1239,8 @@ UNS32 OnStatusUpdate(CO_Data* d, const indextable * indextable_curr, UNS8 bSubin
         /*&smart_statusword_machine,*/ &smart_off_machine
         };
 
-        _machine_exe(CANOpenShellOD_Data, nodeid, &SmartFaultCallback, fault_machine, 1, 1, 0/*1, 0x1*/);
+        _machine_exe(CANOpenShellOD_Data, nodeid, &SmartFaultCallback, fault_machine, 1, 1,
+            0/*1, 0x1*/, NULL);
       }
       else
       {
@@ -1183,6 +1294,10 @@ UNS32 OnInterpUpdate(CO_Data* d, UNS8 nodeid)
     if(((motor_interp_status[nodeid] & 0b1000000000000000) > 0) && (motor_started[nodeid] == 0))
     {
       motor_started[nodeid] = 1;
+
+      clock_gettime(CLOCK_MONOTONIC, &motor_start_time[nodeid]);
+      motor_start_seen[nodeid] = 1;
+      SimulationStartSkewReport();
 #ifdef CANOPENSHELL_VERBOSE
       if(verbose_flag)
       {
@@ -1196,6 +1311,7 @@ UNS32 OnInterpUpdate(CO_Data* d, UNS8 nodeid)
         && (motor_started[nodeid] == 2))
     {
       motor_started[nodeid] = 0;
+      __atomic_store_n(&table_close_pending[nodeid], 0, __ATOMIC_RELEASE);
 
 #ifdef CANOPENSHELL_VERBOSE
       if(verbose_flag)
@@ -1269,6 +1385,7 @@ UNS32 OnInterpUpdate(CO_Data* d, UNS8 nodeid)
         }
 #endif
         add_event(CERR_InterpFIFOUnderError, nodeid, 0, NULL);
+        fifo_control_underflow(nodeid);
       }
       else if((motor_interp_status[nodeid] & 0b0010000000000000) > 0)
       {
@@ -1284,7 +1401,7 @@ UNS32 OnInterpUpdate(CO_Data* d, UNS8 nodeid)
       /*int motor_table_index = MotorTableIndexFromNodeId(nodeid);
        pthread_mutex_lock(&motor_table[motor_table_index].table_mutex);
        printf("INF[%d]: count = %d, cursor = %ld, end = %d\n, read = %d, write = %d, interp = %x\n",
-       nodeid, motor_table[motor_table_index].count,
+       nodeid, QueueCount(&motor_table[motor_table_index]),
        motor_table[motor_table_index].cursor_position, motor_table[motor_table_index].end_reached,
        motor_table[motor_table_index].read_pointer, motor_table[motor_table_index].write_pointer,
        motor_interp_status[nodeid]);
@@ -1303,8 +1420,11 @@ UNS32 OnInterpUpdate(CO_Data* d, UNS8 nodeid)
 
 // Ho bisogno di lasciarmi un posto per un'eventuale chiusura della tabella, dovuta,
 // per esempio, dalla ricezione di un errore dai motori
-        SimulationTableUpdate(d, nodeid, motor_interp_status[nodeid],
-            (motor_interp_status[nodeid] & 0x3F) - 1, 1);
+        // i punti vengono inviati dal thread di interpolazione, che ne calcola
+        // il numero al momento dell'invio (vedi SimulationFeed)
+        if(fifo_control_status(nodeid, motor_interp_status[nodeid] & 0x3F,
+            motor_started[nodeid] == 1) > 0)
+          interp_feeder_post(nodeid, motor_interp_status[nodeid]);
       }
       else
         pthread_mutex_unlock(&robot_state_mux);
@@ -1421,6 +1541,100 @@ UNS32 return_value)
   }
 }
 
+/**
+ * Chiude con l'SDO le tabelle il cui punto di chiusura, inviato con il PDO, non
+ * è stato confermato dal motore in tempo.
+ *
+ * @remark: viene chiamata al SYNC, dal thread di CanFestival.
+ */
+void SimulationTableCloseCheck(CO_Data* d)
+{
+  int motor_index;
+  UNS8 nodeid;
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+  {
+    nodeid = motor_table[motor_index].nodeId;
+
+    if(__atomic_load_n(&table_close_pending[nodeid], __ATOMIC_ACQUIRE) == 0)
+      continue;
+
+    // la simulazione è stata interrotta
+    if(motor_started[nodeid] != 2)
+    {
+      __atomic_store_n(&table_close_pending[nodeid], 0, __ATOMIC_RELEASE);
+      continue;
+    }
+
+    if((now.tv_sec < table_close_deadline[nodeid].tv_sec)
+        || ((now.tv_sec == table_close_deadline[nodeid].tv_sec)
+            && (now.tv_nsec < table_close_deadline[nodeid].tv_nsec)))
+      continue;
+
+    __atomic_store_n(&table_close_pending[nodeid], 0, __ATOMIC_RELEASE);
+
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+    {
+      printf("WARN[%d on node %x]: Table not closed by PDO, closing by SDO\n", SmartMotorError,
+          nodeid);
+    }
+#endif
+
+    struct state_machine_struct *interpolation_machine[] =
+    {
+    &stop_interpolation_machine
+    };
+
+    uintptr_t args[] = { table_close_position[nodeid] };
+
+    _machine_exe(d, nodeid, NULL, interpolation_machine, 1, 1, 1, args);
+  }
+}
+
+/**
+ * Riporta lo scarto tra gli avvii dei motori quando tutti hanno segnalato
+ * l'avvio dell'interpolazione.
+ *
+ * @remark: l'istante di avvio è quello di arrivo dello stato dell'interpolatore
+ * (TPDO1), quindi la risoluzione è quella della sua trasmissione.
+ */
+void SimulationStartSkewReport(void)
+{
+  int motor_index;
+  UNS8 nodeid;
+  long start_us;
+  long first_us = 0;
+  long last_us = 0;
+
+  if(!start_skew_pending)
+    return;
+
+  for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+  {
+    nodeid = motor_table[motor_index].nodeId;
+
+    if(!motor_start_seen[nodeid])
+      return;
+
+    start_us = (motor_start_time[nodeid].tv_sec - simulation_start_request.tv_sec) * 1000000
+        + (motor_start_time[nodeid].tv_nsec - simulation_start_request.tv_nsec) / 1000;
+
+    if((motor_index == 0) || (start_us < first_us))
+      first_us = start_us;
+
+    if((motor_index == 0) || (start_us > last_us))
+      last_us = start_us;
+  }
+
+  start_skew_pending = 0;
+
+  printf("INFO: start skew %ld us (first start after %ld us)\n", last_us - first_us, first_us);
+}
+
 void SimulationTableStart(CO_Data* d)
 {
   int motor_index = 0;
@@ -1434,9 +1648,18 @@ void SimulationTableStart(CO_Data* d)
 
   if(ready == motor_active_number)
   {
+    clock_gettime(CLOCK_MONOTONIC, &simulation_start_request);
+
+    for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+      motor_start_seen[motor_table[motor_index].nodeId] = 0;
+
+    start_skew_pending = 1;
+
     if(fake_flag == 0)
     {
-      printf("Simulation start\n");
+      // con sync i motori ricevono lo start subito ma lo eseguono tutti
+      // insieme al SYNC successivo (RPDO4 sincrono, vedi ConfigureSlaveNode)
+      printf(sync_start_flag ? "Simulation start (SYNC)\n" : "Simulation start\n");
       InterpolationStart = 0x1f;
 
 //d->PDO_status[0].last_message.cob_id = 0;
@@ -1453,67 +1676,37 @@ void SimulationTableStart(CO_Data* d)
   }
 }
 
-void SimulationTableUpdate(CO_Data* d, UNS8 nodeid, UNS16 interpolation_status, int point_number,
-    int from_callback)
+/**
+ * Invia al motore fino a point_number punti della tabella e, se la tabella è
+ * finita, la chiude.
+ *
+ * @return: numero di punti inviati
+ *
+ * @remark: va chiamata solo dal thread di interpolazione (vedi SimulationFeed).
+ */
+static int SimulationTableRefill(CO_Data* d, UNS8 nodeid, int motor_table_index,
+    UNS16 interpolation_status, int point_number, int from_callback)
 {
-  int motor_table_index = MotorTableIndexFromNodeId(nodeid);
-
-  if(motor_table_index < 0)
-  {
-#ifdef CANOPENSHELL_VERBOSE
-    if(verbose_flag)
-    {
-      printf("ERR[%d on node %x]: Impossibile trovare la tabella associata. \n", InternalError,
-          nodeid);
-    }
-#endif
-
-    CERR("CT4", CERR_InternalError);
-    return;
-  }
-
-  /*if(motor_table[motor_table_index].is_pipe)
-   {
-   if((interpolation_status & 0x3F) < 20)
-   return;
-
-   point_number = 20;
-   }*/
-
-  if((motor_active[nodeid] == 0) || (point_number <= 0))
-    return;
-
-  pthread_mutex_lock(&interpolator_mux[nodeid]);
-
-  if(interpolator_busy[nodeid] == 0)
-    interpolator_busy[nodeid] = 1;
-  else
-  {
-    printf("interpolator busy %d\n", nodeid);
-
-    pthread_mutex_unlock(&interpolator_mux[nodeid]);
-
-    return;
-  }
-
-  pthread_mutex_unlock(&interpolator_mux[nodeid]);
-
   int i;
   int point_to_send;
   int valid_point = 0;
   int get_result = 0;
   int send_pdo_result = 0;
   struct table_data_read data_read;
-
-  pthread_mutex_lock(&motor_table[motor_table_index].table_mutex);
-
-  if(point_number >= motor_table[motor_table_index].count)
-    point_to_send = motor_table[motor_table_index].count;
-  else
+  struct interp_point burst_point[INTERP_PDO_BURST_FRAMES / 2];
+  long burst_time_ms[INTERP_PDO_BURST_FRAMES / 2];
+  int burst_count = 0;
+  int j;
+  int limit_violation;
+
+  // il buffer circolare è senza lock: il conteggio può solo crescere finché
+  // questo thread non chiama QueueUpdate. Si fermano prima del primo punto
+  // fuori dai limiti di velocità ed accelerazione
+  point_to_send = motion_limit_check(nodeid, &motor_table[motor_table_index], &limit_violation);
+
+  if(point_number < point_to_send)
     point_to_send = point_number;
 
-  pthread_mutex_unlock(&motor_table[motor_table_index].table_mutex);
-
   /*if(motor_table[motor_table_index].is_pipe == 1)
    QueueSeek(&motor_table[motor_table_index], point_to_send);*/
 
@@ -1536,48 +1729,63 @@ void SimulationTableUpdate(CO_Data* d, UNS8 nodeid, UNS16 interpolation_status,
 
     valid_point++;
 
-    InterpolationTimePeriod[nodeid - MOTOR_INDEX_FIRST] = -3;
-
-    while(data_read.time_ms > 256)
-    {
-      data_read.time_ms = data_read.time_ms / 10;
-
-      InterpolationTimePeriod[nodeid - MOTOR_INDEX_FIRST]++;
-    }
-
-    InterpolationTimeValue[nodeid - MOTOR_INDEX_FIRST] = data_read.time_ms;
-    InterpolationData[nodeid - MOTOR_INDEX_FIRST] = data_read.position;
-
+    // il tempo è già codificato dal riempitore di tabella
     if(fake_flag == 0)
     {
-      d->PDO_status[nodeid - MOTOR_INDEX_FIRST + INTERPOLATION_DATA_INDEX_OFFSET].last_message.cob_id =
-          0;
+      // i punti vengono raccolti e trasmessi insieme, senza passare dal
+      // dizionario e da sendPDOevent
+      burst_point[burst_count].position = data_read.position;
+      burst_point[burst_count].time_value = data_read.time_value;
+      burst_point[burst_count].time_period = data_read.time_period;
+      burst_time_ms[burst_count] = data_read.time_ms;
+      burst_count++;
+
+      // i punti vengono registrati solo dopo la trasmissione, con il SYNC che
+      // l'ha preceduta (vedi fifo_control.c)
+      if(burst_count == INTERP_PDO_BURST_FRAMES / 2)
+      {
+        send_pdo_result += interp_send_burst(nodeid, burst_point, burst_count);
 
-      send_pdo_result = sendPDOevent(d);
+        for(j = 0; j < burst_count; j++)
+          fifo_control_sent(nodeid, burst_time_ms[j]);
 
-      if(send_pdo_result != 0)
-        printf("Errore PDO!\n");
+        burst_count = 0;
+      }
     }
     else
     {
-//motor_position[nodeid] = InterpolationData[nodeid - MOTOR_INDEX_FIRST];
-      smartmotor_table_write(nodeid, &motor_interp_status[nodeid],
-          InterpolationData[nodeid - MOTOR_INDEX_FIRST],
-          InterpolationTimeValue[nodeid - MOTOR_INDEX_FIRST],
-          InterpolationTimePeriod[nodeid - MOTOR_INDEX_FIRST]);
+      interp_last_position[nodeid] = data_read.position;
+
+      smartmotor_table_write(nodeid, &motor_interp_status[nodeid], data_read.position,
+          data_read.time_value, data_read.time_period);
+      fifo_control_sent(nodeid, data_read.time_ms);
     }
   }
 
+  if(burst_count > 0)
+  {
+    send_pdo_result += interp_send_burst(nodeid, burst_point, burst_count);
+
+    for(j = 0; j < burst_count; j++)
+      fifo_control_sent(nodeid, burst_time_ms[j]);
+  }
+
+  if(send_pdo_result != 0)
+    printf("Errore PDO!\n");
+
   //printf("[%d] %d / %d / %d\n", nodeid, valid_point, point_to_send, point_number);
 
   // per uscire dalla modalità ip mode devo impostare l'unità temporale a zero
   // e scrivere l'ultimo valore nella tabella.
-  // Devo utilizzare l'sdo perchè altrimenti il dato non partirebbe in quanto è uguale
-  // a quello precendente
+  // Il punto a tempo zero viene trasmesso via PDO con interp_send, che invia i
+  // frame anche se la posizione è uguale alla precedente; se il motore non
+  // conferma la chiusura, SimulationTableCloseCheck la ripete al SYNC via SDO.
   // Se il motore sta elaborando la tabella e il riempitore di tabella ha finito i punti,
-  // significa che posso bloccare il movimento
-  if((motor_table[motor_table_index].count == 0) // tutti i punti letti sono stati scritti
-  && (motor_table[motor_table_index].end_reached == 1)        // file concluso
+  // significa che posso bloccare il movimento.
+  // end_reached va letto prima del numero di punti: il riempitore lo imposta
+  // solo dopo aver pubblicato l'ultimo punto
+  if((__atomic_load_n(&motor_table[motor_table_index].end_reached, __ATOMIC_ACQUIRE) == 1) // file concluso
+      && (QueueCount(&motor_table[motor_table_index]) == 0) // tutti i punti letti sono stati scritti
       && (valid_point < (interpolation_status & 0x3F)) // punti nella tabella
       && (motor_started[nodeid] != 2) // non ho ancora finalizzato la tabella
       && ((interpolation_status & 0x8000) > 0))
@@ -1589,43 +1797,68 @@ void SimulationTableUpdate(CO_Data* d, UNS8 nodeid, UNS16 interpolation_status,
     motor_started[nodeid] = 2;
     QueueLast(&motor_table[motor_table_index], &data_read);
 
-    InterpolationTimePeriod[nodeid - MOTOR_INDEX_FIRST] = 0;
-    InterpolationTimeValue[nodeid - MOTOR_INDEX_FIRST] = 0;
-    InterpolationData[nodeid - MOTOR_INDEX_FIRST] = data_read.position;
+    interp_last_position[nodeid] = data_read.position;
 
-//TODO: valutare se è possibile usare il PDO aggiornando il flag di scrittura invece che un SDO
     if(fake_flag == 0)
     {
-//d->PDO_status[0].last_message.cob_id = 0;
-      sendPDOevent(d);
+      struct fifo_control_stats fifo_stats;
+      long close_timeout_ms;
+
+      // il punto a tempo zero chiude la tabella: interp_send trasmette sempre la
+      // posizione, anche se uguale alla precedente. Se il motore non conferma la
+      // chiusura entro il tempo dei punti ancora nella FIFO, al SYNC viene
+      // usato l'SDO (vedi SimulationTableCloseCheck)
+      interp_send(nodeid, data_read.position, 0, 0);
+
+      fifo_control_stats_get(nodeid, &fifo_stats);
+      close_timeout_ms = fifo_stats.buffered_ms + TABLE_CLOSE_TIMEOUT_MS;
 
-      struct state_machine_struct *interpolation_machine[] =
+      clock_gettime(CLOCK_MONOTONIC, &table_close_deadline[nodeid]);
+      table_close_deadline[nodeid].tv_sec += close_timeout_ms / 1000;
+      table_close_deadline[nodeid].tv_nsec += (close_timeout_ms % 1000) * 1000000;
+
+      if(table_close_deadline[nodeid].tv_nsec >= 1000000000)
       {
-      &stop_interpolation_machine
-      };
+        table_close_deadline[nodeid].tv_sec++;
+        table_close_deadline[nodeid].tv_nsec -= 1000000000;
+      }
 
-      _machine_exe(CANOpenShellOD_Data, nodeid, NULL, interpolation_machine, 1, 1, 1,
-          data_read.position);
+      table_close_position[nodeid] = data_read.position;
+      __atomic_store_n(&table_close_pending[nodeid], 1, __ATOMIC_RELEASE);
     }
     else
     {
-      smartmotor_table_write(nodeid, &motor_interp_status[nodeid],
-          InterpolationData[nodeid - MOTOR_INDEX_FIRST],
-          InterpolationTimeValue[nodeid - MOTOR_INDEX_FIRST],
-          InterpolationTimePeriod[nodeid - MOTOR_INDEX_FIRST]);
-
-      /*motor_interp_status[nodeid] = 0x122d;
-
-       motor_position[nodeid] =
-       InterpolationData[nodeid - MOTOR_INDEX_FIRST];*/
+      smartmotor_table_write(nodeid, &motor_interp_status[nodeid], data_read.position, 0, 0);
     }
   }
 
-  // Qui uso il mutex in quanto potrebbe esserci un race condition
-  // sul count
-  pthread_mutex_lock(&motor_table[motor_table_index].table_mutex);
   QueueUpdate(&motor_table[motor_table_index], point_to_send);
-  pthread_mutex_unlock(&motor_table[motor_table_index].table_mutex);
+  motion_limit_consumed(nodeid, point_to_send);
+
+  if(limit_violation != MOTION_LIMIT_OK)
+  {
+    struct motion_limit_stats limit_stats;
+    char event_text[100];
+
+    motion_limit_stats_get(nodeid, &limit_stats);
+
+    sprintf(event_text, "punto %ld oltre il limite di %s", limit_stats.violation_point,
+        (limit_violation == MOTION_LIMIT_VELOCITY) ? "velocita'" : "accelerazione");
+
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+    {
+      printf("ERR[%d on node %x]: %s limit exceeded at point %ld\n", InternalError, nodeid,
+          (limit_violation == MOTION_LIMIT_VELOCITY) ? "Velocity" : "Acceleration",
+          limit_stats.violation_point);
+    }
+#endif
+
+    // il punto non è stato inviato: i motori vengono fermati tutti insieme
+    // mentre eseguono ancora i punti validi
+    add_event(CERR_KinematicLimit, nodeid, 0, event_text);
+    SmartStop(0, from_callback);
+  }
 
   if(valid_point != 0)
   {
@@ -1638,10 +1871,56 @@ void SimulationTableUpdate(CO_Data* d, UNS8 nodeid, UNS16 interpolation_status,
     }
   }
 
-  pthread_mutex_lock(&interpolator_mux[nodeid]);
-  interpolator_busy[nodeid] = 0;
-  pthread_mutex_unlock(&interpolator_mux[nodeid]);
+  return valid_point;
+}
 
+void SimulationTableUpdate(CO_Data* d, UNS8 nodeid, UNS16 interpolation_status, int point_number,
+    int from_callback)
+{
+  int motor_table_index = MotorTableIndexFromNodeId(nodeid);
+
+  if(motor_table_index < 0)
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+    {
+      printf("ERR[%d on node %x]: Impossibile trovare la tabella associata. \n", InternalError,
+          nodeid);
+    }
+#endif
+
+    CERR("CT4", CERR_InternalError);
+    return;
+  }
+
+  /*if(motor_table[motor_table_index].is_pipe)
+   {
+   if((interpolation_status & 0x3F) < 20)
+   return;
+
+   point_number = 20;
+   }*/
+
+  if((motor_active[nodeid] == 0) || (point_number <= 0))
+    return;
+
+  // i punti vengono inviati solo dal thread di interpolazione, che serve una
+  // richiesta alla volta: le richieste arrivate nel frattempo vengono già
+  // raccolte da interp_feeder_post
+  SimulationTableRefill(d, nodeid, motor_table_index, interpolation_status, point_number,
+      from_callback);
+}
+
+/**
+ * Invia i punti segnalati dalle callback CAN: viene eseguita dal thread di
+ * interpolazione (vedi interp_feeder.c), fuori dal thread di CanFestival.
+ * Il numero di punti viene calcolato qui, dopo che gli invii precedenti sono
+ * stati registrati.
+ */
+void SimulationFeed(UNS8 nodeid, UNS16 interp_status)
+{
+  SimulationTableUpdate(CANOpenShellOD_Data, nodeid, interp_status,
+      fifo_control_demand(nodeid, motor_started[nodeid] == 1), 0);
 }
 
 void SmartVelocityCallback(CO_Data* d, UNS8 nodeId, int machine_state, int is_register,
@@ -1669,7 +1948,8 @@ void SmartVelocityGet(UNS8 nodeid)
   &smart_velocity_pp_get_machine
   };
 
-  _machine_exe(CANOpenShellOD_Data, nodeid, &SmartVelocityCallback, velocity_machine, 1, 0, 0);
+  _machine_exe(CANOpenShellOD_Data, nodeid, &SmartVelocityCallback, velocity_machine, 1, 0, 0,
+      NULL);
 }
 
 void SmartAccelerationGet(UNS8 nodeid)
@@ -1680,7 +1960,7 @@ void SmartAccelerationGet(UNS8 nodeid)
   };
 
   _machine_exe(CANOpenShellOD_Data, nodeid, &SmartAccelerationCallback, acceleration_machine, 1, 0,
-      0);
+      0, NULL);
 }
 
 void SmartFollowingErrorGet(UNS8 nodeid)
@@ -1691,7 +1971,7 @@ void SmartFollowingErrorGet(UNS8 nodeid)
   };
 
   _machine_exe(CANOpenShellOD_Data, nodeid, &SmartFollowingErrorCallback, following_error_machine,
-      1, 0, 0);
+      1, 0, 0, NULL);
 }
 
 void SmartVelocitySet(char *sdo)
@@ -1710,7 +1990,9 @@ void SmartVelocitySet(char *sdo)
     &smart_velocity_pp_set_machine
     };
 
-    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, velocity_machine, 1, 0, 1, VT);
+    uintptr_t args[] = { VT };
+
+    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, velocity_machine, 1, 0, 1, args);
   }
 }
 
@@ -1770,8 +2052,9 @@ void SmartHome(char *sdo)
 
     struct state_machine_struct *machine = &smart_homing_machine;
 
-    _machine_exe(CANOpenShellOD_Data, nodeid, &SmartCheckCallback, &machine, 1, 0, 3,
-        forward_velocity, backward_velocity, home_offset);
+    uintptr_t args[] = { forward_velocity, backward_velocity, home_offset };
+
+    _machine_exe(CANOpenShellOD_Data, nodeid, &SmartCheckCallback, &machine, 1, 0, 3, args);
   }
   else
     printf("Wrong command  : %s\n", sdo);
@@ -1781,7 +2064,7 @@ void SmartHome(char *sdo)
 void SmartIntTest2(UNS8 nodeid)
 {
   struct state_machine_struct *machine = &smart_interpolation_test2_machine;
-  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0);
+  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0, NULL);
 }
 
 void SmartFileComplete(UNS8 nodeid)
@@ -1816,7 +2099,7 @@ void SmartFileComplete(UNS8 nodeid)
 void SmartIntTest1(UNS8 nodeid)
 {
   struct state_machine_struct *machine = &smart_interpolation_test1_machine;
-  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0);
+  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0, NULL);
 }
 
 void FakePositionUpdate(sigval_t val)
@@ -1833,10 +2116,20 @@ void FakePositionUpdate(sigval_t val)
   //timer_delete(fake_update_timer);
 }
 
-int SimulationStart(UNS8 nodeid)
+/**
+ * Avvia la simulazione per un motore o, con nodeid uguale a 0, per tutti.
+ *
+ * @input start_time_ms: istante della tabella da cui partire (0 dall'inizio)
+ * @input from_callback: 1 se chiamata dal thread di CanFestival
+ */
+int SimulationStart(UNS8 nodeid, long start_time_ms, int from_callback)
 {
   InterpolationStart = 0xF;
 
+  // al SYNC viene controllato il livello della FIFO dell'interpolatore
+  if(fake_flag == 0)
+    CANOpenShellOD_Data->post_sync = CANOpenShellOD_post_sync;
+
   // devo distinguere il caso di broadcast dagli altri per i parametri strettamente
   // legati al motore
   if(nodeid != 0)
@@ -1844,13 +2137,24 @@ int SimulationStart(UNS8 nodeid)
     int motor_table_index = MotorTableIndexFromNodeId(nodeid);
     simulation_ready[motor_table_index] = 0;
 
+    interp_init(CANOpenShellOD_Data->canHandle, nodeid);
+    fifo_control_reset(nodeid);
+    motion_limit_reset(nodeid, motor_position[nodeid]);
+
     if(robot_state != MOVIMENTO_LIBERO)
     {
       if(motor_table_index >= 0)
       {
         motor_table[motor_table_index].is_pipe = 0;
 
-        QueueInit(motor_table[motor_table_index].nodeId, &motor_table[motor_table_index]);
+        if(QueueInit(motor_table[motor_table_index].nodeId, &motor_table[motor_table_index]) < 0)
+        {
+          add_event(CERR_InternalError, nodeid, 0, "no memory for motor table");
+          CERR("CT4", CERR_InternalError);
+          return -1;
+        }
+
+        motor_table[motor_table_index].start_time_ms = start_time_ms;
 
         if(QueueFill(&motor_table[motor_table_index]) < 0)
         {
@@ -1865,14 +2169,18 @@ int SimulationStart(UNS8 nodeid)
       simulation_first_start[nodeid] = 0;
 
       struct state_machine_struct *machine = &init_interpolation_machine;
-      _machine_exe(CANOpenShellOD_Data, nodeid, &SimulationInitCallback, &machine, 1, 0, 1,
-          motor_position[nodeid]);
+      uintptr_t args[] = { motor_position[nodeid] };
+
+      _machine_exe(CANOpenShellOD_Data, nodeid, &SimulationInitCallback, &machine, 1, from_callback, 1,
+          args);
     }
     else
     {
       struct state_machine_struct *machine = &resume_interpolation_machine;
-      _machine_exe(CANOpenShellOD_Data, nodeid, &SimulationInitCallback, &machine, 1, 0, 1,
-          motor_position[nodeid]);
+      uintptr_t args[] = { motor_position[nodeid] };
+
+      _machine_exe(CANOpenShellOD_Data, nodeid, &SimulationInitCallback, &machine, 1, from_callback, 1,
+          args);
     }
   }
   else
@@ -1885,11 +2193,24 @@ int SimulationStart(UNS8 nodeid)
     {
       simulation_ready[motor_index] = 0;
 
+      interp_init(CANOpenShellOD_Data->canHandle, motor_table[motor_index].nodeId);
+      fifo_control_reset(motor_table[motor_index].nodeId);
+      motion_limit_reset(motor_table[motor_index].nodeId,
+          motor_position[motor_table[motor_index].nodeId]);
+
       if(robot_state != MOVIMENTO_LIBERO)
       {
         motor_table[motor_index].is_pipe = 0;
 
-        QueueInit(motor_table[motor_index].nodeId, &motor_table[motor_index]);
+        if(QueueInit(motor_table[motor_index].nodeId, &motor_table[motor_index]) < 0)
+        {
+          add_event(CERR_InternalError, motor_table[motor_index].nodeId, 0,
+              "no memory for motor table");
+          CERR("CT4", CERR_InternalError);
+          return -1;
+        }
+
+        motor_table[motor_index].start_time_ms = start_time_ms;
 
         if(QueueFill(&motor_table[motor_index]) < 0)
         {
@@ -1903,9 +2224,12 @@ int SimulationStart(UNS8 nodeid)
         simulation_first_start[motor_table[motor_index].nodeId] = 0;
 
         if(fake_flag == 0)
+        {
+          uintptr_t args[] = { motor_position[motor_table[motor_index].nodeId] };
+
           _machine_exe(CANOpenShellOD_Data, motor_table[motor_index].nodeId,
-              &SimulationInitCallback, &init_interpolation, 1, 0, 1,
-              motor_position[motor_table[motor_index].nodeId]);
+              &SimulationInitCallback, &init_interpolation, 1, from_callback, 1, args);
+        }
         else
         {
           SimulationInitCallback(CANOpenShellOD_Data, motor_table[motor_index].nodeId, 0, 0, 0);
@@ -1919,9 +2243,12 @@ int SimulationStart(UNS8 nodeid)
       else
       {
         if(fake_flag == 0)
+        {
+          uintptr_t args[] = { motor_position[motor_table[motor_index].nodeId] };
+
           _machine_exe(CANOpenShellOD_Data, motor_table[motor_index].nodeId,
-              &SimulationInitCallback, &resume_interpolation, 1, 0, 1,
-              motor_position[motor_table[motor_index].nodeId]);
+              &SimulationInitCallback, &resume_interpolation, 1, from_callback, 1, args);
+        }
         else
         {
           SimulationInitCallback(CANOpenShellOD_Data, motor_table[motor_index].nodeId, 0, 0, 0);
@@ -1941,7 +2268,7 @@ int SimulationStart(UNS8 nodeid)
 void SmartIntStart(UNS8 nodeid)
 {
   struct state_machine_struct *machine = &start_interpolation_machine;
-  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0);
+  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0, NULL);
 }
 
 void SmartPositionCallback(CO_Data* d, UNS8 nodeId, int machine_state, int is_register,
@@ -1970,6 +2297,71 @@ UNS32 return_value)
     printf("Errore PDO!\n");
 }
 
+/**
+ * Porta in modalità posizione il motore della tabella indicata; usata per i
+ * movimenti in broadcast.
+ */
+static void SmartPositionMotor(int motor_index, long position, long velocity, long acceleration,
+    int start, int from_callback)
+{
+  struct state_machine_struct *machine[] =
+  {
+  &smart_position_set_machine, &smart_position_start_machine
+  };
+
+  simulation_first_start[motor_table[motor_index].nodeId] = 1;
+//motor_started[motor_table[motor_index].nodeId] = 0;
+
+  if(fake_flag)
+  {
+    smartmotor_path_reset(motor_table[motor_index].nodeId,
+        &motor_status[motor_table[motor_index].nodeId]);
+
+    smartmotor_path_generate(motor_table[motor_index].nodeId, 8000,
+        motor_position[motor_table[motor_index].nodeId], position, velocity, acceleration);
+
+    motor_started[motor_table[motor_index].nodeId] = 1;
+    motor_mode[motor_table[motor_index].nodeId] = 0x1;
+    //motor_position[motor_table[motor_index].nodeId] = position;
+    if(start)
+      motor_status[motor_table[motor_index].nodeId] |= 0b0001000000000000;
+
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+    {
+      printf("SUCC[node %x]: set target point\n", motor_table[motor_index].nodeId);
+      printf("SUCC[node %x]: smart motor go to target point. . .\n",
+          motor_table[motor_index].nodeId);
+    }
+#endif
+  }
+  else
+  {
+    if(motor_started[motor_table[motor_index].nodeId] == 0)
+    {
+      motor_started[motor_table[motor_index].nodeId] = 1;
+      QueueInit(motor_table[motor_index].nodeId, &motor_table[motor_index]);
+
+      uintptr_t args[] = { acceleration, acceleration, velocity, position };
+
+      _machine_exe(CANOpenShellOD_Data, motor_table[motor_index].nodeId, NULL, machine, 2,
+          from_callback, 4, args);
+    }
+    else
+    {
+      int send_pdo_result;
+      send_pdo_result = interp_send_target(motor_table[motor_index].nodeId, velocity,
+          position);
+
+      if(send_pdo_result != 0)
+        printf("Errore PDO!\n");
+
+      if(start)
+        SmartPositionCallback(CANOpenShellOD_Data, motor_table[motor_index].nodeId, 0, 0, 0);
+    }
+  }
+}
+
 /**
  *
  */
@@ -1992,71 +2384,16 @@ void SmartPosition(UNS8 nodeid, long position, long velocity, long acceleration,
   struct state_machine_struct *machine[] =
   {
   &smart_position_set_machine, &smart_position_start_machine
-  };
-
-  if(start)
-    machine_callback = &SmartPositionCallback;
-
-  if(nodeid == 0)
-  {
-    int motor_index;
-    for(motor_index = 0; motor_index < motor_active_number; motor_index++)
-    {
-      simulation_first_start[motor_table[motor_index].nodeId] = 1;
-//motor_started[motor_table[motor_index].nodeId] = 0;
-
-      if(fake_flag)
-      {
-        smartmotor_path_reset(motor_table[motor_index].nodeId,
-            &motor_status[motor_table[motor_index].nodeId]);
-
-        smartmotor_path_generate(motor_table[motor_index].nodeId, 8000,
-            motor_position[motor_table[motor_index].nodeId], position, velocity, acceleration);
-
-        motor_started[motor_table[motor_index].nodeId] = 1;
-        motor_mode[motor_table[motor_index].nodeId] = 0x1;
-        //motor_position[motor_table[motor_index].nodeId] = position;
-        if(start)
-          motor_status[motor_table[motor_index].nodeId] |= 0b0001000000000000;
-
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("SUCC[node %x]: set target point\n", motor_table[motor_index].nodeId);
-          printf("SUCC[node %x]: smart motor go to target point. . .\n",
-              motor_table[motor_index].nodeId);
-        }
-#endif
-      }
-      else
-      {
-        if(motor_started[motor_table[motor_index].nodeId] == 0)
-        {
-          motor_started[motor_table[motor_index].nodeId] = 1;
-          QueueInit(motor_table[motor_index].nodeId, &motor_table[motor_index]);
-
-          _machine_exe(CANOpenShellOD_Data, motor_table[motor_index].nodeId, NULL, machine, 2,
-              from_callback, 4, acceleration, acceleration, velocity, position);
-        }
-        else
-        {
-          VelocityProfile[motor_table[motor_index].nodeId - MOTOR_INDEX_FIRST] = velocity;
-          PositionTarget[motor_table[motor_index].nodeId - MOTOR_INDEX_FIRST] = position;
-
-          CANOpenShellOD_Data->PDO_status[motor_table[motor_index].nodeId - MOTOR_INDEX_FIRST
-              + TARGET_POSITION_INDEX_OFFSET].last_message.cob_id = 0;
-
-          int send_pdo_result;
-          send_pdo_result = sendPDOevent(CANOpenShellOD_Data);
+  };
 
-          if(send_pdo_result != 0)
-            printf("Errore PDO!\n");
+  if(start)
+    machine_callback = &SmartPositionCallback;
 
-          if(start)
-            SmartPositionCallback(CANOpenShellOD_Data, motor_table[motor_index].nodeId, 0, 0, 0);
-        }
-      }
-    }
+  if(nodeid == 0)
+  {
+    int motor_index;
+    for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+      SmartPositionMotor(motor_index, position, velocity, acceleration, start, from_callback);
   }
   else
   {
@@ -2076,20 +2413,16 @@ void SmartPosition(UNS8 nodeid, long position, long velocity, long acceleration,
 
         QueueInit(nodeid, &motor_table[motor_table_index]);
 
+        uintptr_t args[] = { acceleration, acceleration, velocity, position };
+
         _machine_exe(CANOpenShellOD_Data, nodeid, machine_callback, machine, 1, from_callback, 4,
-            acceleration, acceleration, velocity, position);
+            args);
 
       }
       else
       {
         //printf("[%d] Resume position %ld with velocity %ld\n", nodeid, position, velocity);
-        VelocityProfile[nodeid - MOTOR_INDEX_FIRST] = velocity;
-        PositionTarget[nodeid - MOTOR_INDEX_FIRST] = position;
-
-        CANOpenShellOD_Data->PDO_status[nodeid - MOTOR_INDEX_FIRST + TARGET_POSITION_INDEX_OFFSET].last_message.cob_id =
-            0;
-
-        send_pdo_result = sendPDOevent(CANOpenShellOD_Data);
+        send_pdo_result = interp_send_target(nodeid, velocity, position);
 
         if(send_pdo_result != 0)
           printf("Errore PDO!\n");
@@ -2135,6 +2468,80 @@ void SmartPosition(UNS8 nodeid, long position, long velocity, long acceleration,
   }
 }
 
+/**
+ * Avvia la simulazione dall'istante indicato (CT4 T<ms>).
+ *
+ * La modalità IP parte dalla posizione attuale del motore, per cui i motori
+ * lontani dal primo punto della tabella vengono prima portati su di esso in
+ * modalità posizione; la simulazione parte in SmartPositionTargetCallback
+ * quando sono arrivati tutti.
+ *
+ * @input start_time_ms: istante della tabella da cui partire
+ * @return 0 se la simulazione è partita o i motori sono in movimento, -1 se
+ *         non è possibile leggere le tabelle
+ */
+static int SimulationSeek(long start_time_ms)
+{
+  long seek_position[TABLE_MAX_NUM];
+  int seek_needed = 0;
+  struct table_data_read data_read;
+
+  int motor_index;
+  for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+  {
+    UNS8 nodeId = motor_table[motor_index].nodeId;
+
+    motor_table[motor_index].is_pipe = 0;
+
+    if(QueueInit(nodeId, &motor_table[motor_index]) < 0)
+    {
+      add_event(CERR_InternalError, nodeId, 0, "no memory for motor table");
+      CERR("CT4", CERR_InternalError);
+      return -1;
+    }
+
+    motor_table[motor_index].start_time_ms = start_time_ms;
+
+    if((QueueFill(&motor_table[motor_index]) < 0) || (QueueCount(&motor_table[motor_index]) <= 0)
+        || (QueueGet(&motor_table[motor_index], &data_read, 0) < 0))
+    {
+      CERR("CT4", CERR_FileError);
+      return -1;
+    }
+
+    seek_position[motor_index] = data_read.position;
+
+    if(labs(seek_position[motor_index] - motor_position[nodeId]) > SIMULATION_SEEK_TOLERANCE)
+      seek_needed = 1;
+  }
+
+  if(seek_needed == 0)
+    return SimulationStart(0, start_time_ms, 0);
+
+  pthread_mutex_lock(&robot_state_mux);
+  robot_state = CENTRAGGIO;
+  simulation_seek_ms = start_time_ms;
+  pthread_mutex_unlock(&robot_state_mux);
+
+  InterpolationStart = 0x2f;
+
+  CANOpenShellOD_Data->PDO_status[INTERPOLATION_START_INDEX_OFFSET].last_message.cob_id = 0;
+
+  if(sendPDOevent(CANOpenShellOD_Data) != 0)
+    printf("Errore PDO!\n");
+
+  // i motori già sul primo punto restano fermi e non vengono attesi
+  for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+  {
+    if(labs(seek_position[motor_index] - motor_position[motor_table[motor_index].nodeId])
+        > SIMULATION_SEEK_TOLERANCE)
+      SmartPositionMotor(motor_index, seek_position[motor_index], SIMULATION_SEEK_VELOCITY,
+          SIMULATION_SEEK_ACCELERATION, 1, 0);
+  }
+
+  return 0;
+}
+
 void SmartEmergencyCallback(CO_Data* d, UNS8 nodeId, int machine_state, int is_register,
 UNS32 return_value)
 {
@@ -2161,12 +2568,10 @@ UNS32 return_value)
 
     QueueLast(&motor_table[motor_table_index], &data_read);
 
-    InterpolationTimePeriod[nodeId - MOTOR_INDEX_FIRST] = 0;
-    InterpolationTimeValue[nodeId - MOTOR_INDEX_FIRST] = 0;
-    InterpolationData[nodeId - MOTOR_INDEX_FIRST] = data_read.position;
+    interp_last_position[nodeId] = data_read.position;
 
-    //d->PDO_status[0].last_message.cob_id = 0;
-    sendPDOevent(d);
+    if(fake_flag == 0)
+      interp_send(nodeId, data_read.position, 0, 0);
   }
   else
     pthread_mutex_unlock(&robot_state_mux);
@@ -2177,14 +2582,17 @@ UNS32 return_value)
     // fosse attivo
     for(motor_index = 0; motor_index < (motor_active_number + 1); motor_index++)
     {
-      QueueInit(motor_table[motor_index].nodeId, &motor_table[motor_index]);
+      // l'ultimo giro è per la tabella di broadcast, che è l'ultima dell'array
+      int table_index = (motor_index < motor_active_number) ? motor_index : TABLE_MAX_NUM;
 
-      simulation_first_start[motor_table[motor_index].nodeId] = 1;
-      motor_started[motor_table[motor_index].nodeId] = 0;
+      QueueInit(motor_table[table_index].nodeId, &motor_table[table_index]);
+
+      simulation_first_start[motor_table[table_index].nodeId] = 1;
+      motor_started[motor_table[table_index].nodeId] = 0;
 
       if(fake_flag)
       {
-        NodeId = motor_table[motor_index].nodeId;
+        NodeId = motor_table[table_index].nodeId;
         motor_status[NodeId] = 0b0000000000110111;
         motor_interp_status[NodeId] = 0x122d;
         motor_mode[NodeId] = 0x1;
@@ -2291,13 +2699,11 @@ UNS32 return_value)
     //{
     QueueLast(&motor_table[motor_table_index], &data_read);
 
-    InterpolationTimePeriod[nodeId - MOTOR_INDEX_FIRST] = 0;
-    InterpolationTimeValue[nodeId - MOTOR_INDEX_FIRST] = 0;
-    InterpolationData[nodeId - MOTOR_INDEX_FIRST] = data_read.position;
+    interp_last_position[nodeId] = data_read.position;
     //}
 
-    //d->PDO_status[0].last_message.cob_id = 0;
-    sendPDOevent(d);
+    if(fake_flag == 0)
+      interp_send(nodeId, data_read.position, 0, 0);
   }
   else
     pthread_mutex_unlock(&robot_state_mux);
@@ -2321,9 +2727,11 @@ UNS32 return_value)
 
     // Voglio resettare tutti i processi in coda, compreso quello di broadcast, nel caso
     // fosse attivo
-    for(motor_index = 0; motor_index < (motor_active_number + 1); motor_index++)
+    for(motor_index = 0; motor_index < motor_active_number; motor_index++)
       QueueInit(motor_table[motor_index].nodeId, &motor_table[motor_index]);
 
+    QueueInit(motor_table[TABLE_MAX_NUM].nodeId, &motor_table[TABLE_MAX_NUM]);
+
     pthread_mutex_lock(&robot_state_mux);
     if((robot_state == SIMULAZIONE) || (robot_state == RILASCIATO)
         || (robot_state == MOVIMENTO_LIBERO) || (robot_state == CHIUSURA))
@@ -2361,7 +2769,8 @@ int SmartStop(UNS8 nodeid, int from_callback)
   if(fake_flag == 0)
   {
     struct state_machine_struct *machine = &smart_stop_machine;
-    if(_machine_exe(CANOpenShellOD_Data, nodeid, &SmartStopCallback, &machine, 1, from_callback, 0))
+    if(_machine_exe(CANOpenShellOD_Data, nodeid, &SmartStopCallback, &machine, 1, from_callback, 0,
+        NULL))
       return 1;
   }
   else
@@ -2445,8 +2854,10 @@ void SmartRelease(UNS8 nodeid, int from_callback, int brake)
       &smart_limit_disable_machine, &torque_machine
       };
 
+      uintptr_t args[] = { 0 };
+
       _machine_exe(CANOpenShellOD_Data, nodeid, &SmartReleaseBrakeCallback, machine, 2,
-          from_callback, 1, 0);
+          from_callback, 1, args);
     }
     else
     {
@@ -2455,8 +2866,10 @@ void SmartRelease(UNS8 nodeid, int from_callback, int brake)
       &smart_limit_enable_machine, &smart_off_machine
       };
 
+      uintptr_t args[] = { 0 };
+
       _machine_exe(CANOpenShellOD_Data, nodeid, &SmartReleaseBrakeCallback, machine, 2,
-          from_callback, 1, 0);
+          from_callback, 1, args);
     }
   }
   else
@@ -2496,12 +2909,20 @@ void StartHeart(char* sdo)
   if(ret == 2)
   {
     struct state_machine_struct *machine = &heart_start_machine;
-    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 1, time_ms);
+    uintptr_t args[] = { time_ms };
+
+    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 1, args);
   }
   else
     printf("Wrong command  : %s\n", sdo);
 }
 
+/* Timer callback: rilegge lo stato del motore che non era ancora pronto */
+void ProgramUploadPoll(CO_Data* d, UNS32 nodeid)
+{
+  SmartProgramUpload(d, (UNS8) nodeid);
+}
+
 int SmartProgramUpload(CO_Data* d, UNS8 nodeid)
 {
   char command[32];
@@ -2550,6 +2971,13 @@ int SmartProgramUpload(CO_Data* d, UNS8 nodeid)
           machine_state++;
           goto block_read;
         }
+        else
+        {
+          // il motore non ha ancora preparato il programma: invece di
+          // rileggere subito lo stato dal thread CAN, la lettura viene
+          // ripetuta dal timer
+          SetAlarm(d, nodeid, ProgramUploadPoll, MS_TO_TIMEVAL(PROGRAM_UPLOAD_POLL_MS), 0);
+        }
       }
       else
       {
@@ -2791,10 +3219,14 @@ void Map1TPDO(char *sdo)
 
   if((ret >= 3) && (ret <= 6))
   {
-    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 12, 0x1800 | pdo_number,
-        0xC0000000 | cob_id, 0x1A00 | pdo_number, 0x1A00 | pdo_number, mapping_object1,
-        0x1A00 | pdo_number, 0x1800 | pdo_number, 0x40000000 | cob_id, 0x1800 | pdo_number,
-        transmission_type, 0x1800 | pdo_number, transmission_time);
+    uintptr_t args[] =
+    {
+        0x1800 | pdo_number, 0xC0000000 | cob_id, 0x1A00 | pdo_number, 0x1A00 | pdo_number,
+        mapping_object1, 0x1A00 | pdo_number, 0x1800 | pdo_number, 0x40000000 | cob_id,
+        0x1800 | pdo_number, transmission_type, 0x1800 | pdo_number, transmission_time
+    };
+
+    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 12, args);
   }
   else
     printf("Wrong command  : %s\n", sdo);
@@ -2820,11 +3252,15 @@ void Map2TPDO(char *sdo)
 
   if((ret >= 3) && (ret <= 7))
   {
-    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 14, 0x1800 | pdo_number,
-        0xC0000000 | cob_id, 0x1A00 | pdo_number, 0x1A00 | pdo_number, mapping_object1,
-        0x1A00 | pdo_number, 0x1A00 | pdo_number, mapping_object2, 0x1A00 | pdo_number,
+    uintptr_t args[] =
+    {
+        0x1800 | pdo_number, 0xC0000000 | cob_id, 0x1A00 | pdo_number, 0x1A00 | pdo_number,
+        mapping_object1, 0x1A00 | pdo_number, mapping_object2, 0x1A00 | pdo_number,
         0x1800 | pdo_number, 0x40000000 | cob_id, 0x1800 | pdo_number, transmission_type,
-        0x1800 | pdo_number, transmission_time);
+        0x1800 | pdo_number, transmission_time
+    };
+
+    _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 14, args);
   }
   else
     printf("Wrong command  : %s\n", sdo);
@@ -2834,7 +3270,7 @@ void Map2TPDO(char *sdo)
 void StartNode(UNS8 nodeid)
 {
   struct state_machine_struct *machine = &smart_start_machine;
-  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0);
+  _machine_exe(CANOpenShellOD_Data, nodeid, NULL, &machine, 1, 0, 0, NULL);
 }
 
 /* Ask a slave node to reset */
@@ -2993,6 +3429,46 @@ void CheckReadSDO(CO_Data* d, UNS8 nodeid)
   closeSDOtransfer(CANOpenShellOD_Data, nodeid, SDO_CLIENT);
 }
 
+/* Print the SDO transfer times of the state machines, per node and per index */
+void SdoStatsPrint(char* sdo)
+{
+  int ret = 0;
+  int nodeid;
+  int i;
+  unsigned int index;
+  struct sdo_stats stats;
+
+  ret = sscanf(sdo, "sdot#%2x", &nodeid);
+  if((ret == 1) && (nodeid < CANOPEN_NODE_NUMBER))
+  {
+    for(i = 1; i < CANOPEN_NODE_NUMBER; i++)
+    {
+      if(((nodeid != 0) && (i != nodeid)) || (sdo_stats_node_get(i, &stats) < 0)
+          || (stats.transfer_count == 0))
+        continue;
+
+      printf("NodeId %2.2x : %lu transfers, %lu errors, mean %llu us, max %lu us, last %lu us, "
+          "%lu timeouts, %lu retries\n", i, stats.transfer_count, stats.error_count,
+          stats.total_us / stats.transfer_count, stats.max_us, stats.last_us, stats.timeout_count,
+          stats.retry_count);
+    }
+
+    // i tempi per oggetto sono di tutti i motori
+    if(nodeid == 0)
+    {
+      for(i = 0; sdo_stats_index_get(i, &index, &stats) == 0; i++)
+      {
+        printf("Index %4.4x : %lu transfers, %lu errors, mean %llu us, max %lu us, last %lu us, "
+            "%lu timeouts, %lu retries\n", index, stats.transfer_count, stats.error_count,
+            stats.total_us / stats.transfer_count, stats.max_us, stats.last_us, stats.timeout_count,
+            stats.retry_count);
+      }
+    }
+  }
+  else
+    printf("Wrong command  : %s\n", sdo);
+}
+
 /* Callback function that check the write SDO demand */
 void CheckWriteSDO(CO_Data* d, UNS8 nodeid)
 {
@@ -3154,15 +3630,17 @@ UNS32 return_value)
 
     if((return_value & 0b0100000000000000) > 0) // right(+) limit
     {
-      _machine_exe(d, nodeId, NULL, position_machine, 2, 1, 4, 10, 10, 100000,
-          motor_position[nodeId] - 16000);
+      uintptr_t args[] = { 10, 10, 100000, motor_position[nodeId] - 16000 };
+
+      _machine_exe(d, nodeId, NULL, position_machine, 2, 1, 4, args);
 
       return;
     }
     else if((return_value & 0b1000000000000000) > 0)  // left(-) limit
     {
-      _machine_exe(d, nodeId, NULL, position_machine, 2, 1, 4, 10, 10, 100000,
-          motor_position[nodeId] + 16000);
+      uintptr_t args[] = { 10, 10, 100000, motor_position[nodeId] + 16000 };
+
+      _machine_exe(d, nodeId, NULL, position_machine, 2, 1, 4, args);
       return;
     }
   }
@@ -3193,7 +3671,9 @@ UNS32 return_value)
       int motor_index;
       int queuefill_return = 0;
 
-      motor_index = MotorTableIndexFromNodeId(0);
+      // la tabella di broadcast è l'ultima dell'array, dopo quelle dei motori
+      // (vedi QueuePutPipe)
+      motor_index = TABLE_MAX_NUM;
 
       motor_table[motor_index].is_pipe = 1;
 
@@ -3240,6 +3720,23 @@ void ConfigureSlaveNode(CO_Data* d, UNS8 nodeid)
 {
   _machine_reset(d, nodeid);
 
+  // la tabella viene assegnata al primo avvio del motore: se sono già tutte
+  // occupate il motore non può essere gestito
+  int motor_table_index = MotorTableIndexFromNodeId(nodeid);
+
+  if((motor_table_index == -1) && (MotorSlotFree(d) < 0))
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+    {
+      printf("ERR[%d on node %x]: no free motor slot (max %d)\n", CERR_InternalError, nodeid,
+          MotorSlotCount(d));
+    }
+#endif
+    add_event(CERR_InternalError, nodeid, 0, "no free motor slot");
+    return;
+  }
+
   if(motor_active[nodeid] == 0)
   {
     pthread_mutex_lock(&motor_active_number_mutex);
@@ -3314,11 +3811,10 @@ void ConfigureSlaveNode(CO_Data* d, UNS8 nodeid)
           &smart_start_machine
       };
 
-      _machine_exe(d, nodeid, &ConfigureSlaveNodeCallback, configure_pdo_machine, 10, 1, 113,
-
-      100,
-
-      0x1800, 0xC0000180 + nodeid, 0x1A00, 0x1A00, 0x20000008, 0x1A00, 0x60410010, 0x1A00, 0x24000010,
+      uintptr_t args[] =
+      {
+          100,
+          0x1800, 0xC0000180 + nodeid, 0x1A00, 0x1A00, 0x20000008, 0x1A00, 0x60410010, 0x1A00, 0x24000010,
           0x1A00, 0x60610008, 0x1A00, 0x1800, 0x40000180 + nodeid, 0x1800, SYNC_DIVIDER_STATUS, 0x1800, 0, /*19*/
 
           0x1801, 0xC0000280 + nodeid, 0x1A01, 0x1A01, 0x20000008, 0x1A01, 0x60630020, 0x1A01, 0x1801,
@@ -3339,9 +3835,12 @@ void ConfigureSlaveNode(CO_Data* d, UNS8 nodeid)
           0x1402, 0xC0000400 + nodeid, 0x1602, 0x1602, 0x60c10120, 0x1602, 0x1402,
           0x40000400 + nodeid, 0x1402, 0xFE, 0x1402, 0, /*99*/
 
-          0x1403, 0xC0000400, 0x1603, 0x1603, 0x60400010, 0x1603, 0x1403, 0x40000400, 0x1403, 0xFE,
+          0x1403, 0xC0000400, 0x1603, 0x1603, 0x60400010, 0x1603, 0x1403, 0x40000400, 0x1403,
+          (sync_start_flag ? 0 : 0xFE), // con sync lo start viene eseguito al SYNC successivo
           0x1403, 0 /*111*/
-          );
+      };
+
+      _machine_exe(d, nodeid, &ConfigureSlaveNodeCallback, configure_pdo_machine, 10, 1, 113, args);
 
       canopen_abort_code = RegisterSetODentryCallBack(d, 0x6061, 0, &OnStatusUpdate);
 
@@ -3436,10 +3935,11 @@ void ConfigureSlaveNode(CO_Data* d, UNS8 nodeid)
       };
 
       //if((motor_active_number ==  2) || (motor_active_number ==  3)) {
-      _machine_exe(d, nodeid, &ConfigureSlaveNodeCallback, configure_slave_machine, 10, 1, 113, 100,
-
-      0x1800, 0xC0000180 + nodeid, 0x1A00, 0x1A00, 0x20000008, 0x1A00, 0x60410010, 0x1A00, 0x24000010,
-         0x1A00, 0x60610008, 0x1A00, 0x1800, 0x40000180 + nodeid, 0x1800, SYNC_DIVIDER_STATUS, 0x1800, 0, /*19*/
+      uintptr_t args[] =
+      {
+          100,
+          0x1800, 0xC0000180 + nodeid, 0x1A00, 0x1A00, 0x20000008, 0x1A00, 0x60410010, 0x1A00, 0x24000010,
+          0x1A00, 0x60610008, 0x1A00, 0x1800, 0x40000180 + nodeid, 0x1800, SYNC_DIVIDER_STATUS, 0x1800, 0, /*19*/
 
           0x1801, 0xC0000280 + nodeid, 0x1A01, 0x1A01, 0x20000008, 0x1A01, 0x60630020, 0x1A01, 0x1801,
           0x40000280 + nodeid, 0x1801, 0xFE, 0x1801, 10, /*33*/
@@ -3456,13 +3956,16 @@ void ConfigureSlaveNode(CO_Data* d, UNS8 nodeid)
           0x1402, 0xC0000400 + nodeid, 0x1602, 0x1602, 0x60c10120, 0x1602, 0x1402,
           0x40000400 + nodeid, 0x1402, 0xFE, 0x1402, 0, /*87*/
 
-          0x1403, 0xC0000400, 0x1603, 0x1603, 0x60400010, 0x1603, 0x1403, 0x40000400, 0x1403, 0xFE,
+          0x1403, 0xC0000400, 0x1603, 0x1603, 0x60400010, 0x1603, 0x1403, 0x40000400, 0x1403,
+          (sync_start_flag ? 0 : 0xFE), // con sync lo start viene eseguito al SYNC successivo
           0x1403, 0, /*99*/
 
           0x1404, 0xC0000380, 0x1604, 0x1604, 0x10130020, 0x1604, 0x1404, 0x40000380, 0x1404, 0xFE,
           0x1404, 0 /*111*/
+      };
 
-          );
+      _machine_exe(d, nodeid, &ConfigureSlaveNodeCallback, configure_slave_machine, 10, 1, 113,
+          args);
       //}
     }
 
@@ -3471,29 +3974,42 @@ void ConfigureSlaveNode(CO_Data* d, UNS8 nodeid)
 
   SmartClear(nodeid);
 
-  pthread_mutex_init(&interpolator_mux[nodeid], NULL);
-
 // Controllo se una tabella sia stata già assegnata, altrimenti ne
 // trovo una libera
-  int motor_table_index = MotorTableIndexFromNodeId(nodeid);
 
   if(motor_table_index == -1) // tabella non assegnata
   {
-    int i;
-    for(i = 0; i < TABLE_MAX_NUM; i++)
+    motor_table_index = MotorSlotFree(d);
+
+    if(motor_table_index < 0)
     {
-      if(motor_table[i].nodeId == 0)
+#ifdef CANOPENSHELL_VERBOSE
+      if(verbose_flag)
       {
-        pthread_mutex_init(&motor_table[i].table_mutex, NULL);
-        QueueInit(nodeid, &motor_table[i]);
-        break;
+        printf("ERR[%d on node %x]: no free motor slot (max %d)\n", CERR_InternalError, nodeid,
+            MotorSlotCount(d));
       }
+#endif
+      add_event(CERR_InternalError, nodeid, 0, "no free motor slot");
+      return;
     }
+
+    pthread_mutex_init(&motor_table[motor_table_index].table_mutex, NULL);
+    pthread_cond_init(&motor_table[motor_table_index].table_refill, NULL);
   }
-  else
+
+  // se manca la memoria il buffer resta da allocare: ogni QueueInit ci riprova
+  // e CT4 fallisce finché non ci riesce
+  if(QueueInit(nodeid, &motor_table[motor_table_index]) < 0)
+    add_event(CERR_InternalError, nodeid, 0, "no memory for motor table");
+
+  if((fake_flag == 0) && (MotorSlotAssign(d, motor_table_index, nodeid) < 0))
   {
-    QueueInit(nodeid, &motor_table[motor_table_index]);
+    add_event(CERR_InternalError, nodeid, 0, "invalid motor slot");
+    return;
   }
+
+  interp_init(d->canHandle, nodeid);
 }
 
 void CANOpenShellOD_post_Emcy(CO_Data* d, UNS8 nodeID, UNS16 errCode, UNS8 errReg,
@@ -3823,6 +4339,9 @@ void CANOpenShellOD_post_sync(CO_Data* d)
       {
         simulation_first_start[motor_table[motor_index].nodeId] = 1;
 
+        // lo stato simulato è campionato adesso: i punti già scritti vi sono compresi
+        fifo_control_sync(motor_table[motor_index].nodeId, 0);
+
         NodeId = motor_table[motor_index].nodeId;
         Statusword = motor_status[NodeId];
         Interpolation_Mode_Status = motor_interp_status[NodeId]; //9201
@@ -3846,24 +4365,45 @@ void CANOpenShellOD_post_sync(CO_Data* d)
       for(motor_index = 0; motor_index < motor_active_number; motor_index++)
       {
         /*printf("SmartPosition [%d] pos [%ld] read [%d] write [%d]\n",
-         motor_table[motor_index].nodeId, motor_table[motor_index].position[0],
-         motor_table[motor_index].read_pointer,
-         motor_table[motor_index].write_pointer);*/
+         motor_table[motor_index].nodeId, motor_table[motor_index].stream_position,
+         motor_table[motor_index].position_update,
+         motor_table[motor_index].position_start);*/
 
-        if(motor_table[motor_index].read_pointer)
+        if(motor_table[motor_index].position_update)
         {
           if(motor_started[motor_table[motor_index].nodeId])
           {
-            SmartPosition(motor_table[motor_index].nodeId, motor_table[motor_index].position[0],
+            SmartPosition(motor_table[motor_index].nodeId, motor_table[motor_index].stream_position,
                 motor_table[motor_index].forward_velocity, 100,
-                motor_table[motor_index].write_pointer, 1);
+                motor_table[motor_index].position_start, 1);
           }
 
-          if(motor_table[motor_index].write_pointer)
-            motor_table[motor_index].write_pointer = 0;
+          if(motor_table[motor_index].position_start)
+            motor_table[motor_index].position_start = 0;
         }
       }
     }
+    else if(robot_state == SIMULAZIONE)
+    {
+      pthread_mutex_unlock(&robot_state_mux);
+
+      int motor_index;
+      int point_to_send;
+      UNS8 nodeid;
+
+      // tra due stati dell'interpolatore il motore continua a consumare punti:
+      // se la FIFO stimata scende sotto il livello desiderato li invio in anticipo
+      for(motor_index = 0; motor_index < motor_active_number; motor_index++)
+      {
+        nodeid = motor_table[motor_index].nodeId;
+        point_to_send = fifo_control_sync(nodeid, motor_started[nodeid] == 1);
+
+        if(point_to_send > 0)
+          interp_feeder_post(nodeid, motor_interp_status[nodeid]);
+      }
+
+      SimulationTableCloseCheck(d);
+    }
     else
       pthread_mutex_unlock(&robot_state_mux);
   }
@@ -3940,6 +4480,9 @@ void help_menu(void)
   printf("   OPTIONAL COMMAND:\n");
   printf("     fake : run with fake motor\n");
   printf("     verb : activate debug messages\n");
+  printf("     mmap : read motor tables through memory mapping\n");
+  printf("     sync : start the interpolation of all motors on the same SYNC\n");
+  printf("     sdom#max : max SDO transfers in flight on the bus (0 default)\n");
   printf("       ex: load#libcanfestival_can_socket.so,0,1M,8\n");
   printf("   NETWORK: (if nodeid=0x00 : broadcast)\n");
   printf("     srst#nodeid : Reset a node\n");
@@ -3952,6 +4495,8 @@ void help_menu(void)
   printf("        ex : rsdo#42,1018,01\n");
   printf("     wsdo#nodeid,index,subindex,size,data : write sdo\n");
   printf("        ex : wsdo#42,6200,01,01,FF\n");
+  printf("     sdot#nodeid : state machine SDO times (00 all nodes and indexes)\n");
+  printf("     sdoz : reset state machine SDO times\n");
   printf("\n");
   printf("   SMART MOTOR:\n");
   printf("     CT0 M<num_mot> : Discover nodes and check if there's num_mot motors\n");
@@ -3961,7 +4506,7 @@ void help_menu(void)
       "     CB2 P1 : start homing procedure for all motors. Parameters has been read by motor's file \n");
   printf("     CT2 P2 : all motors returns to the center point \n");
   printf("     CT2 P3 : release motors with brake \n");
-  printf("     CT4 : starts simulation \n");
+  printf("     CT4 [T<ms>] : starts simulation, optionally from the given time \n");
   printf("     CB4 : starts simulation \n");
   printf("     CT5 : stops simulation (valid only in simulation state) \n");
   printf("     CT6 : quit application \n");
@@ -3972,6 +4517,19 @@ void help_menu(void)
   printf("     PR5 M<mot_num> O<index_hex> S<subindex> T<bit_num><tipo> <valore> :\n");
   printf("        imposta il valore dell'oggetto canopen indicato \n");
   printf("        ex : PR5 M119 O6065 S0 T32U 100\n");
+  printf("     PR7: controlla i file di simulazione di tutti i motori\n");
+  printf("     PR8 M<mot_num> N<punti> L<soglia_min> H<soglia_max> :\n");
+  printf("        imposta la coda del motore (M0 tutti, 0 valore predefinito)\n");
+  printf("        ex : PR8 M0 N2048 L512 H2048\n");
+  printf("     PR8 M<mot_num> : dimensioni della coda e tempo richiesto, codificato ed errore in ms\n");
+  printf("     PR9 M<mot_num> [T<livello>] :\n");
+  printf("        imposta il livello della FIFO dell'interpolatore (M0 tutti, 0 valore predefinito)\n");
+  printf("        o, senza T, ne restituisce le statistiche\n");
+  printf("        ex : PR9 M0 T30\n");
+  printf("     PR0 M<mot_num> [V<vel_max> A<acc_max>] :\n");
+  printf("        imposta i limiti di velocita' (passi/s) ed accelerazione (passi/s^2) dei punti\n");
+  printf("        della tabella (M0 tutti, 0 disabilita) o, senza V ed A, ne restituisce le statistiche\n");
+  printf("        ex : PR0 M0 V400000 A2000000\n");
 
   printf(
       "     shom#nodeid,offset,vel_forw,vel_back : start homing for nodeid with forward velocity vel_forw, backward velocity vel_back and distance from limit equal to offset\n");
@@ -4043,12 +4601,14 @@ void ExitFromLimit(int nodeid, int from_callback)
       {
         if(fake_flag == 0)
         {
+          uintptr_t args[] = { 0x1 };
+
 #ifdef NO_LIMITS
           _machine_exe(CANOpenShellOD_Data, motor_table[motor_index].nodeId, &ExitFromLimitCallback,
-              exit_from_limit_machine, 1, from_callback, 1, 0x1);
+              exit_from_limit_machine, 1, from_callback, 1, args);
 #else
           _machine_exe(CANOpenShellOD_Data, motor_table[motor_index].nodeId, &ExitFromLimitCallback,
-              exit_from_limit_machine, 2, from_callback, 1, 0x1);
+              exit_from_limit_machine, 2, from_callback, 1, args);
 #endif
         }
         else
@@ -4077,11 +4637,13 @@ void ExitFromLimit(int nodeid, int from_callback)
     {
       if(fake_flag == 0)
       {
+        uintptr_t args[] = { 0x1 };
+
 #ifdef NO_LIMITS
-        _machine_exe(CANOpenShellOD_Data, nodeid, &ExitFromLimitCallback, exit_from_limit_machine, 1, from_callback, 1, 0x1);
+        _machine_exe(CANOpenShellOD_Data, nodeid, &ExitFromLimitCallback, exit_from_limit_machine, 1, from_callback, 1, args);
 #else
         _machine_exe(CANOpenShellOD_Data, nodeid, &ExitFromLimitCallback, exit_from_limit_machine,
-            2, from_callback, 1, 0x1);
+            2, from_callback, 1, args);
 #endif
       }
       else
@@ -4161,7 +4723,7 @@ void ProcessEmergencyTripode(char* command)
         &smart_limit_disable_machine, &smart_stop_machine
         };
 
-        _machine_exe(CANOpenShellOD_Data, 0, &SmartEmergencyCallback, machine, 2, 0, 0);
+        _machine_exe(CANOpenShellOD_Data, 0, &SmartEmergencyCallback, machine, 2, 0, 0, NULL);
       }
       else
       {
@@ -4205,6 +4767,7 @@ int ProcessCommandTripode(char* command)
   long velocity;
   long acceleration;
   char start;
+  unsigned long total_time_ms = 0;
 
   switch(command[2] - '0')
   {
@@ -4371,6 +4934,10 @@ int ProcessCommandTripode(char* command)
             }
           }
 
+          // durante la ricerca del centro preparo l'indice dei file tabella
+          for(parse_num = 0; parse_num < motor_active_number; parse_num++)
+            FileIndexPrepare(motor_table[parse_num].nodeId);
+
           pthread_mutex_lock(&robot_state_mux);
           robot_state = RICERCA_CENTRO;
           pthread_mutex_unlock(&robot_state_mux);
@@ -4417,6 +4984,7 @@ int ProcessCommandTripode(char* command)
           }
 
           robot_state = CENTRAGGIO;
+          simulation_seek_ms = 0;
           pthread_mutex_unlock(&robot_state_mux);
           SmartPosition(0, 0, 300000, 10, 1, 0);
 
@@ -4459,7 +5027,29 @@ int ProcessCommandTripode(char* command)
 
       pthread_mutex_unlock(&robot_state_mux);
 
-      SimulationStart(0);
+      // CT4 T<ms> fa partire la simulazione dall'istante indicato
+      position = 0;
+      parse_num = sscanf(command, "CT4 T%ld", &position);
+
+      if((parse_num != 1) && (command[3] == ' ') && (command[4] == 'T'))
+        goto fail;
+
+      // i file vengono controllati tutti prima di muovere i motori; se non sono
+      // cambiati dall'ultimo controllo viene letto solo il loro indice
+      if(FileValidate(motor_table, motor_active_number, &total_time_ms) < 0)
+      {
+        return_event();
+        CERR("CT4", CERR_FileError);
+        break;
+      }
+
+      if((position < 0) || ((position > 0) && ((unsigned long) position >= total_time_ms)))
+        goto fail;
+
+      if(position > 0)
+        SimulationSeek(position);
+      else
+        SimulationStart(0, 0, 0);
       break;
 
     case 5:
@@ -4664,7 +5254,8 @@ int ProcessCommandBraccio(char* command)
         &smart_limit_enable_machine, &smart_set_mode_machine
         };
 
-        _machine_exe(CANOpenShellOD_Data, 0, &InitJoystickCallback, set_position_machine, 2, 0, 0);
+        _machine_exe(CANOpenShellOD_Data, 0, &InitJoystickCallback, set_position_machine, 2, 0, 0,
+            NULL);
       }
       else
       {
@@ -4753,6 +5344,16 @@ int ProcessParameterTripode(char* command)
   int size = 0;
   char type;
   long value = 0;
+  unsigned long total_time_ms = 0;
+  unsigned int capacity = 0;
+  int low_watermark = 0;
+  int high_watermark = 0;
+  int motor_configured = 0;
+  int fifo_target = 0;
+  struct fifo_control_stats fifo_stats;
+  unsigned long max_velocity = 0;
+  unsigned long max_acceleration = 0;
+  struct motion_limit_stats limit_stats;
 
   switch(command[2] - '0')
   {
@@ -4825,6 +5426,154 @@ int ProcessParameterTripode(char* command)
       OK(parse_str);
       break;
 
+    case 7:
+      pthread_mutex_lock(&robot_state_mux);
+      if(robot_state == SIMULAZIONE)
+      {
+        pthread_mutex_unlock(&robot_state_mux);
+        goto permission_denied;
+      }
+
+      pthread_mutex_unlock(&robot_state_mux);
+
+      if(motor_active_number == 0)
+      {
+        CERR("PR7", CERR_ConfigError);
+        break;
+      }
+
+      if(FileValidate(motor_table, motor_active_number, &total_time_ms) == 0)
+      {
+        sprintf(parse_str, "PR7: %d, %lu", motor_active_number, total_time_ms);
+        OK(parse_str);
+      }
+      else
+      {
+        return_event();
+        CERR("PR7", CERR_FileError);
+      }
+      break;
+
+    case 8:
+      parse_num = sscanf(command, "PR8 M%d N%u L%d H%d", &nodeid, &capacity, &low_watermark,
+          &high_watermark);
+
+      // senza N, L ed H restituisce le dimensioni della coda e l'errore di
+      // codifica dei tempi, anche durante la simulazione
+      if((parse_num == 1) && (nodeid != 0) && (MotorTableIndexFromNodeId(nodeid) >= 0))
+      {
+        struct table_data *table = &motor_table[MotorTableIndexFromNodeId(nodeid)];
+
+        sprintf(parse_str, "PR8: %u, %d, %d, %ld, %ld, %ld", table->capacity, table->low_watermark,
+            table->high_watermark, table->time_encoder.source_ms, table->time_encoder.encoded_ms,
+            table->time_encoder.encoded_ms - table->time_encoder.source_ms);
+        OK(parse_str);
+        break;
+      }
+
+      pthread_mutex_lock(&robot_state_mux);
+      if(robot_state == SIMULAZIONE)
+      {
+        pthread_mutex_unlock(&robot_state_mux);
+        goto permission_denied;
+      }
+
+      pthread_mutex_unlock(&robot_state_mux);
+
+      if(parse_num != 4)
+        goto fail;
+
+      // M0 imposta le dimensioni per tutti i motori; vengono applicate al
+      // prossimo avvio della simulazione
+      for(parse_num = 0; parse_num < motor_active_number; parse_num++)
+      {
+        if((nodeid != 0) && (motor_table[parse_num].nodeId != nodeid))
+          continue;
+
+        if(QueueConfigure(&motor_table[parse_num], capacity, low_watermark, high_watermark) < 0)
+          goto fail;
+
+        motor_configured++;
+      }
+
+      if(motor_configured == 0)
+        goto fail;
+
+      OK("PR8");
+      break;
+
+    case 9:
+      parse_num = sscanf(command, "PR9 M%d T%d", &nodeid, &fifo_target);
+
+      if(parse_num == 2)
+      {
+        // M0 imposta il livello per tutti i motori, anche durante la simulazione
+        for(parse_num = 0; parse_num < motor_active_number; parse_num++)
+        {
+          if((nodeid != 0) && (motor_table[parse_num].nodeId != nodeid))
+            continue;
+
+          if(fifo_control_configure(motor_table[parse_num].nodeId, fifo_target) < 0)
+            goto fail;
+
+          motor_configured++;
+        }
+
+        if(motor_configured == 0)
+          goto fail;
+
+        OK("PR9");
+      }
+      else if((parse_num == 1) && (MotorTableIndexFromNodeId(nodeid) >= 0))
+      {
+        fifo_control_stats_get(nodeid, &fifo_stats);
+
+        sprintf(parse_str, "PR9: %d, %d, %d, %d, %d, %ld, %lu, %lu, %lu, %lu", fifo_stats.target,
+            fifo_stats.level, fifo_stats.level_min, fifo_stats.level_max, fifo_stats.level_mean,
+            fifo_stats.buffered_ms, fifo_stats.underflow_count, fifo_stats.status_send_count,
+            fifo_stats.sync_send_count, fifo_stats.point_count);
+        OK(parse_str);
+      }
+      else
+        goto fail;
+      break;
+
+    case 0:
+      parse_num = sscanf(command, "PR0 M%d V%lu A%lu", &nodeid, &max_velocity, &max_acceleration);
+
+      if(parse_num == 3)
+      {
+        // M0 imposta i limiti per tutti i motori, anche durante la simulazione
+        for(parse_num = 0; parse_num < motor_active_number; parse_num++)
+        {
+          if((nodeid != 0) && (motor_table[parse_num].nodeId != nodeid))
+            continue;
+
+          if(motion_limit_configure(motor_table[parse_num].nodeId, max_velocity, max_acceleration)
+              < 0)
+            goto fail;
+
+          motor_configured++;
+        }
+
+        if(motor_configured == 0)
+          goto fail;
+
+        OK("PR0");
+      }
+      else if((parse_num == 1) && (MotorTableIndexFromNodeId(nodeid) >= 0))
+      {
+        motion_limit_stats_get(nodeid, &limit_stats);
+
+        sprintf(parse_str, "PR0: %lu, %lu, %lu, %lu, %lu, %d, %ld", limit_stats.max_velocity,
+            limit_stats.max_acceleration, limit_stats.peak_velocity, limit_stats.peak_acceleration,
+            limit_stats.point_count, limit_stats.violation, limit_stats.violation_point);
+        OK(parse_str);
+      }
+      else
+        goto fail;
+      break;
+
     case 5:
       pthread_mutex_lock(&robot_state_mux);
       if((robot_state == RICERCA_CENTRO) || (robot_state == SIMULAZIONE)
@@ -4910,6 +5659,21 @@ int ProcessCommand(char* command)
           verbose_flag = 1;
           break;
 
+        case cst_str4('m', 'm', 'a', 'p'):
+          mmap_flag = 1;
+          break;
+
+        case cst_str4('s', 'y', 'n', 'c'):
+          sync_start_flag = 1;
+          break;
+
+        case cst_str4('s', 'd', 'o', 'm'): // SDO in flight max
+          if((sscanf(command, "sdom#%d", &ret) != 1) || (_machine_sdo_configure(ret) < 0))
+            printf("Invalid sdom parameters\n");
+
+          ret = 0;
+          break;
+
         case cst_str4('l', 'o', 'a', 'd'): // Library Interface
           ret = sscanf(command, "load#%100[^,],%30[^,],%4[^,],%d", LibraryPath, BoardBusName,
               BoardBaudRate, &NodeID);
@@ -4933,7 +5697,7 @@ int ProcessCommand(char* command)
 
         case cst_str4('s', 'i', 'm', 'u'):
           LeaveMutex();
-          SimulationStart(ExtractNodeId(command + 5));
+          SimulationStart(ExtractNodeId(command + 5), 0, 0);
           break;
 
         case cst_str4('s', 's', 't', 'o'): // Smart Stop
@@ -4970,6 +5734,14 @@ int ProcessCommand(char* command)
           ReadDeviceEntry(command);
           break;
 
+        case cst_str4('s', 'd', 'o', 't'): // SDO transfer times
+          SdoStatsPrint(command);
+          break;
+
+        case cst_str4('s', 'd', 'o', 'z'): // Reset SDO transfer times
+          sdo_stats_reset();
+          break;
+
         case cst_str4('s', 'v', 'e', 'l'):
           LeaveMutex();
           SmartVelocityGet(ExtractNodeId(command + 5));
@@ -5130,7 +5902,7 @@ void *PipePositionWriteHandler()
         // pronte per essere lette dal motore al prossimo ciclo di update.
         if((file_complete_min == 0)
             || (file_complete[motor_table[motor_index].nodeId] < file_complete_min))
-          file_complete_min = motor_table[motor_index].count;
+          file_complete_min = QueueCount(&motor_table[motor_index]);
       }
     }
 
@@ -5237,6 +6009,8 @@ void closing()
   else
     unlink(FAKE_POSITION_FIFO_FILE);
 
+  interp_feeder_stop();
+
   _machine_destroy();
 
   if(fake_flag == 0)
@@ -5366,6 +6140,9 @@ int main(int argc, char** argv)
 
   _machine_init();
 
+  // thread che invia i punti di interpolazione ai motori
+  interp_feeder_start(&SimulationFeed, INTERP_FEEDER_PRIORITY);
+
   if(fake_flag == 0)
   {
 //heartbeatInit(CANOpenShellOD_Data);
@@ -25,7 +25,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define eprintf(...) printf (__VA_ARGS__)
 #endif
 
-#define TABLE_MAX_NUM 6
+#define TABLE_MAX_NUM 24 // limite delle tabelle, i motori gestibili dipendono anche dai PDO del master (vedi MotorSlotCount)
 
 #include <canfestival.h>
 
@@ -35,6 +35,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 //#define NO_LIMITS
 
 extern int fake_flag;
+extern int mmap_flag;
 
 void help(void);
 void StartNode(UNS8);
@@ -58,7 +58,8 @@ enum enum_cerr
   CERR_PermissionDenied = 0x13, /**< Inviato comando dallo stato sbalgiato */
   CERR_SimulationError = 0x14, /**< Errore nella simulazione */
   CERR_MotorFault = 0x15, /**< Canopen entrato nello stato "Fault" */
-  CERR_FileError = 0x16 /**< Errore nella linea del file .mot */
+  CERR_FileError = 0x16, /**< Errore nella linea del file .mot */
+  CERR_KinematicLimit = 0x17 /**< Punto della tabella oltre i limiti di velocità o accelerazione */
 };
 
 struct
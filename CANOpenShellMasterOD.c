@@ -2096,7 +2096,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x1406 :   Receive PDO 7 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1406 = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1406_COB_ID_used_by_PDO = 0x2F7;	/* 759 */
+                    UNS32 CANOpenShellMasterOD_obj1406_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj1406_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj1406_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj1406_Compatibility_Entry = 0x0;	/* 0 */
@@ -2115,7 +2115,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x1407 :   Receive PDO 8 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1407 = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1407_COB_ID_used_by_PDO = 0x2F8;	/* 760 */
+                    UNS32 CANOpenShellMasterOD_obj1407_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj1407_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj1407_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj1407_Compatibility_Entry = 0x0;	/* 0 */
@@ -2134,7 +2134,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x1408 :   Receive PDO 9 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1408 = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1408_COB_ID_used_by_PDO = 0x2F9;	/* 761 */
+                    UNS32 CANOpenShellMasterOD_obj1408_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj1408_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj1408_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj1408_Compatibility_Entry = 0x0;	/* 0 */
@@ -2153,7 +2153,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x1409 :   Receive PDO 10 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1409 = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1409_COB_ID_used_by_PDO = 0x2FA;	/* 762 */
+                    UNS32 CANOpenShellMasterOD_obj1409_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj1409_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj1409_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj1409_Compatibility_Entry = 0x0;	/* 0 */
@@ -2172,7 +2172,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x140A :   Receive PDO 11 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj140A = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj140A_COB_ID_used_by_PDO = 0x2FB;	/* 763 */
+                    UNS32 CANOpenShellMasterOD_obj140A_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj140A_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj140A_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj140A_Compatibility_Entry = 0x0;	/* 0 */
@@ -2191,7 +2191,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x140B :   Receive PDO 12 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj140B = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj140B_COB_ID_used_by_PDO = 0x2FC;	/* 764 */
+                    UNS32 CANOpenShellMasterOD_obj140B_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj140B_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj140B_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj140B_Compatibility_Entry = 0x0;	/* 0 */
@@ -2210,7 +2210,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x140C :   Receive PDO 13 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj140C = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj140C_COB_ID_used_by_PDO = 0x3F7;	/* 1015 */
+                    UNS32 CANOpenShellMasterOD_obj140C_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj140C_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj140C_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj140C_Compatibility_Entry = 0x0;	/* 0 */
@@ -2229,7 +2229,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x140D :   Receive PDO 14 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj140D = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj140D_COB_ID_used_by_PDO = 0x3F8;	/* 1016 */
+                    UNS32 CANOpenShellMasterOD_obj140D_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj140D_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj140D_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj140D_Compatibility_Entry = 0x0;	/* 0 */
@@ -2248,7 +2248,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x140E :   Receive PDO 15 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj140E = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj140E_COB_ID_used_by_PDO = 0x3F9;	/* 1017 */
+                    UNS32 CANOpenShellMasterOD_obj140E_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj140E_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj140E_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj140E_Compatibility_Entry = 0x0;	/* 0 */
@@ -2267,7 +2267,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x140F :   Receive PDO 16 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj140F = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj140F_COB_ID_used_by_PDO = 0x3FA;	/* 1018 */
+                    UNS32 CANOpenShellMasterOD_obj140F_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj140F_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj140F_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj140F_Compatibility_Entry = 0x0;	/* 0 */
@@ -2286,7 +2286,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x1410 :   Receive PDO 17 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1410 = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1410_COB_ID_used_by_PDO = 0x3FB;	/* 1019 */
+                    UNS32 CANOpenShellMasterOD_obj1410_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj1410_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj1410_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj1410_Compatibility_Entry = 0x0;	/* 0 */
@@ -2305,7 +2305,7 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
 
 /* index 0x1411 :   Receive PDO 18 Parameter. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1411 = 6; /* number of subindex - 1*/
-                    UNS32 CANOpenShellMasterOD_obj1411_COB_ID_used_by_PDO = 0x3FC;	/* 1020 */
+                    UNS32 CANOpenShellMasterOD_obj1411_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
                     UNS8 CANOpenShellMasterOD_obj1411_Transmission_Type = 0xFF;	/* 255 */
                     UNS16 CANOpenShellMasterOD_obj1411_Inhibit_Time = 0x0;	/* 0 */
                     UNS8 CANOpenShellMasterOD_obj1411_Compatibility_Entry = 0x0;	/* 0 */
@@ -2322,6 +2322,1032 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1411_SYNC_start_value, NULL }
                      };
 
+/* index 0x1412 :   Receive PDO 19 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1412 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1412_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
+                    UNS8 CANOpenShellMasterOD_obj1412_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1412_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1412_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1412_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1412_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1412[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1412, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1412_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1412_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1412_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1412_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1412_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1412_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1413 :   Receive PDO 20 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1413 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1413_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
+                    UNS8 CANOpenShellMasterOD_obj1413_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1413_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1413_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1413_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1413_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1413[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1413, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1413_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1413_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1413_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1413_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1413_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1413_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1414 :   Receive PDO 21 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1414 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1414_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
+                    UNS8 CANOpenShellMasterOD_obj1414_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1414_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1414_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1414_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1414_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1414[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1414, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1414_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1414_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1414_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1414_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1414_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1414_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1415 :   Receive PDO 22 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1415 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1415_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
+                    UNS8 CANOpenShellMasterOD_obj1415_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1415_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1415_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1415_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1415_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1415[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1415, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1415_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1415_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1415_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1415_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1415_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1415_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1416 :   Receive PDO 23 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1416 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1416_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
+                    UNS8 CANOpenShellMasterOD_obj1416_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1416_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1416_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1416_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1416_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1416[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1416, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1416_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1416_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1416_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1416_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1416_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1416_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1417 :   Receive PDO 24 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1417 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1417_COB_ID_used_by_PDO = 0x80000180;	/* 2147484032 */
+                    UNS8 CANOpenShellMasterOD_obj1417_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1417_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1417_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1417_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1417_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1417[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1417, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1417_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1417_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1417_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1417_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1417_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1417_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1418 :   Receive PDO 25 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1418 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1418_COB_ID_used_by_PDO = 0x2F7;	/* 759 */
+                    UNS8 CANOpenShellMasterOD_obj1418_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1418_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1418_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1418_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1418_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1418[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1418, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1418_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1418_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1418_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1418_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1418_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1418_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1419 :   Receive PDO 26 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1419 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1419_COB_ID_used_by_PDO = 0x2F8;	/* 760 */
+                    UNS8 CANOpenShellMasterOD_obj1419_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1419_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1419_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1419_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1419_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1419[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1419, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1419_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1419_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1419_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1419_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1419_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1419_SYNC_start_value, NULL }
+                     };
+
+/* index 0x141A :   Receive PDO 27 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj141A = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj141A_COB_ID_used_by_PDO = 0x2F9;	/* 761 */
+                    UNS8 CANOpenShellMasterOD_obj141A_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj141A_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141A_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj141A_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141A_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index141A[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj141A, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj141A_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141A_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141A_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141A_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141A_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141A_SYNC_start_value, NULL }
+                     };
+
+/* index 0x141B :   Receive PDO 28 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj141B = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj141B_COB_ID_used_by_PDO = 0x2FA;	/* 762 */
+                    UNS8 CANOpenShellMasterOD_obj141B_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj141B_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141B_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj141B_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141B_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index141B[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj141B, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj141B_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141B_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141B_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141B_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141B_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141B_SYNC_start_value, NULL }
+                     };
+
+/* index 0x141C :   Receive PDO 29 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj141C = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj141C_COB_ID_used_by_PDO = 0x2FB;	/* 763 */
+                    UNS8 CANOpenShellMasterOD_obj141C_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj141C_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141C_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj141C_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141C_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index141C[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj141C, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj141C_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141C_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141C_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141C_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141C_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141C_SYNC_start_value, NULL }
+                     };
+
+/* index 0x141D :   Receive PDO 30 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj141D = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj141D_COB_ID_used_by_PDO = 0x2FC;	/* 764 */
+                    UNS8 CANOpenShellMasterOD_obj141D_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj141D_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141D_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj141D_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141D_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index141D[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj141D, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj141D_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141D_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141D_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141D_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141D_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141D_SYNC_start_value, NULL }
+                     };
+
+/* index 0x141E :   Receive PDO 31 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj141E = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj141E_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj141E_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj141E_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141E_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj141E_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141E_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index141E[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj141E, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj141E_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141E_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141E_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141E_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141E_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141E_SYNC_start_value, NULL }
+                     };
+
+/* index 0x141F :   Receive PDO 32 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj141F = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj141F_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj141F_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj141F_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141F_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj141F_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj141F_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index141F[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj141F, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj141F_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141F_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141F_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141F_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj141F_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj141F_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1420 :   Receive PDO 33 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1420 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1420_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1420_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1420_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1420_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1420_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1420_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1420[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1420, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1420_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1420_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1420_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1420_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1420_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1420_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1421 :   Receive PDO 34 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1421 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1421_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1421_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1421_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1421_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1421_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1421_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1421[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1421, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1421_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1421_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1421_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1421_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1421_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1421_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1422 :   Receive PDO 35 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1422 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1422_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1422_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1422_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1422_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1422_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1422_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1422[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1422, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1422_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1422_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1422_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1422_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1422_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1422_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1423 :   Receive PDO 36 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1423 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1423_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1423_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1423_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1423_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1423_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1423_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1423[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1423, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1423_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1423_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1423_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1423_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1423_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1423_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1424 :   Receive PDO 37 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1424 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1424_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1424_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1424_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1424_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1424_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1424_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1424[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1424, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1424_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1424_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1424_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1424_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1424_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1424_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1425 :   Receive PDO 38 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1425 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1425_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1425_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1425_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1425_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1425_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1425_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1425[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1425, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1425_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1425_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1425_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1425_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1425_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1425_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1426 :   Receive PDO 39 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1426 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1426_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1426_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1426_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1426_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1426_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1426_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1426[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1426, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1426_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1426_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1426_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1426_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1426_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1426_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1427 :   Receive PDO 40 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1427 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1427_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1427_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1427_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1427_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1427_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1427_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1427[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1427, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1427_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1427_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1427_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1427_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1427_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1427_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1428 :   Receive PDO 41 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1428 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1428_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1428_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1428_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1428_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1428_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1428_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1428[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1428, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1428_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1428_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1428_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1428_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1428_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1428_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1429 :   Receive PDO 42 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1429 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1429_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj1429_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1429_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1429_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1429_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1429_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1429[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1429, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1429_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1429_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1429_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1429_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1429_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1429_SYNC_start_value, NULL }
+                     };
+
+/* index 0x142A :   Receive PDO 43 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj142A = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj142A_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj142A_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj142A_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142A_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj142A_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142A_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index142A[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj142A, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj142A_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142A_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142A_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142A_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142A_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142A_SYNC_start_value, NULL }
+                     };
+
+/* index 0x142B :   Receive PDO 44 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj142B = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj142B_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj142B_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj142B_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142B_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj142B_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142B_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index142B[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj142B, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj142B_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142B_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142B_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142B_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142B_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142B_SYNC_start_value, NULL }
+                     };
+
+/* index 0x142C :   Receive PDO 45 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj142C = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj142C_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj142C_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj142C_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142C_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj142C_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142C_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index142C[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj142C, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj142C_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142C_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142C_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142C_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142C_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142C_SYNC_start_value, NULL }
+                     };
+
+/* index 0x142D :   Receive PDO 46 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj142D = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj142D_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj142D_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj142D_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142D_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj142D_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142D_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index142D[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj142D, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj142D_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142D_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142D_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142D_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142D_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142D_SYNC_start_value, NULL }
+                     };
+
+/* index 0x142E :   Receive PDO 47 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj142E = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj142E_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj142E_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj142E_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142E_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj142E_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142E_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index142E[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj142E, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj142E_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142E_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142E_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142E_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142E_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142E_SYNC_start_value, NULL }
+                     };
+
+/* index 0x142F :   Receive PDO 48 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj142F = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj142F_COB_ID_used_by_PDO = 0x80000280;	/* 2147484288 */
+                    UNS8 CANOpenShellMasterOD_obj142F_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj142F_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142F_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj142F_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj142F_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index142F[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj142F, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj142F_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142F_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142F_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142F_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj142F_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj142F_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1430 :   Receive PDO 49 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1430 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1430_COB_ID_used_by_PDO = 0x3F7;	/* 1015 */
+                    UNS8 CANOpenShellMasterOD_obj1430_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1430_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1430_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1430_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1430_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1430[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1430, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1430_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1430_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1430_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1430_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1430_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1430_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1431 :   Receive PDO 50 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1431 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1431_COB_ID_used_by_PDO = 0x3F8;	/* 1016 */
+                    UNS8 CANOpenShellMasterOD_obj1431_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1431_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1431_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1431_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1431_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1431[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1431, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1431_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1431_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1431_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1431_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1431_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1431_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1432 :   Receive PDO 51 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1432 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1432_COB_ID_used_by_PDO = 0x3F9;	/* 1017 */
+                    UNS8 CANOpenShellMasterOD_obj1432_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1432_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1432_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1432_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1432_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1432[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1432, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1432_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1432_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1432_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1432_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1432_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1432_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1433 :   Receive PDO 52 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1433 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1433_COB_ID_used_by_PDO = 0x3FA;	/* 1018 */
+                    UNS8 CANOpenShellMasterOD_obj1433_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1433_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1433_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1433_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1433_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1433[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1433, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1433_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1433_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1433_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1433_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1433_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1433_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1434 :   Receive PDO 53 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1434 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1434_COB_ID_used_by_PDO = 0x3FB;	/* 1019 */
+                    UNS8 CANOpenShellMasterOD_obj1434_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1434_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1434_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1434_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1434_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1434[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1434, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1434_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1434_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1434_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1434_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1434_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1434_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1435 :   Receive PDO 54 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1435 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1435_COB_ID_used_by_PDO = 0x3FC;	/* 1020 */
+                    UNS8 CANOpenShellMasterOD_obj1435_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1435_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1435_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1435_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1435_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1435[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1435, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1435_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1435_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1435_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1435_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1435_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1435_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1436 :   Receive PDO 55 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1436 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1436_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1436_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1436_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1436_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1436_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1436_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1436[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1436, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1436_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1436_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1436_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1436_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1436_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1436_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1437 :   Receive PDO 56 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1437 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1437_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1437_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1437_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1437_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1437_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1437_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1437[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1437, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1437_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1437_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1437_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1437_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1437_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1437_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1438 :   Receive PDO 57 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1438 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1438_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1438_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1438_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1438_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1438_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1438_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1438[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1438, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1438_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1438_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1438_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1438_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1438_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1438_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1439 :   Receive PDO 58 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1439 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1439_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1439_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1439_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1439_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1439_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1439_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1439[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1439, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1439_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1439_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1439_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1439_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1439_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1439_SYNC_start_value, NULL }
+                     };
+
+/* index 0x143A :   Receive PDO 59 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj143A = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj143A_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj143A_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj143A_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143A_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj143A_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143A_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index143A[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj143A, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj143A_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143A_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143A_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143A_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143A_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143A_SYNC_start_value, NULL }
+                     };
+
+/* index 0x143B :   Receive PDO 60 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj143B = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj143B_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj143B_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj143B_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143B_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj143B_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143B_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index143B[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj143B, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj143B_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143B_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143B_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143B_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143B_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143B_SYNC_start_value, NULL }
+                     };
+
+/* index 0x143C :   Receive PDO 61 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj143C = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj143C_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj143C_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj143C_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143C_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj143C_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143C_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index143C[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj143C, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj143C_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143C_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143C_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143C_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143C_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143C_SYNC_start_value, NULL }
+                     };
+
+/* index 0x143D :   Receive PDO 62 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj143D = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj143D_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj143D_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj143D_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143D_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj143D_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143D_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index143D[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj143D, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj143D_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143D_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143D_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143D_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143D_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143D_SYNC_start_value, NULL }
+                     };
+
+/* index 0x143E :   Receive PDO 63 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj143E = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj143E_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj143E_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj143E_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143E_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj143E_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143E_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index143E[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj143E, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj143E_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143E_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143E_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143E_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143E_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143E_SYNC_start_value, NULL }
+                     };
+
+/* index 0x143F :   Receive PDO 64 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj143F = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj143F_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj143F_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj143F_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143F_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj143F_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj143F_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index143F[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj143F, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj143F_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143F_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143F_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143F_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj143F_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj143F_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1440 :   Receive PDO 65 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1440 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1440_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1440_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1440_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1440_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1440_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1440_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1440[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1440, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1440_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1440_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1440_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1440_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1440_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1440_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1441 :   Receive PDO 66 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1441 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1441_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1441_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1441_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1441_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1441_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1441_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1441[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1441, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1441_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1441_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1441_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1441_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1441_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1441_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1442 :   Receive PDO 67 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1442 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1442_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1442_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1442_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1442_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1442_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1442_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1442[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1442, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1442_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1442_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1442_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1442_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1442_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1442_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1443 :   Receive PDO 68 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1443 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1443_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1443_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1443_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1443_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1443_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1443_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1443[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1443, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1443_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1443_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1443_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1443_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1443_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1443_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1444 :   Receive PDO 69 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1444 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1444_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1444_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1444_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1444_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1444_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1444_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1444[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1444, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1444_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1444_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1444_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1444_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1444_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1444_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1445 :   Receive PDO 70 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1445 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1445_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1445_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1445_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1445_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1445_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1445_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1445[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1445, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1445_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1445_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1445_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1445_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1445_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1445_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1446 :   Receive PDO 71 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1446 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1446_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1446_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1446_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1446_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1446_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1446_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1446[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1446, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1446_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1446_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1446_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1446_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1446_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1446_SYNC_start_value, NULL }
+                     };
+
+/* index 0x1447 :   Receive PDO 72 Parameter. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1447 = 6; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1447_COB_ID_used_by_PDO = 0x80000380;	/* 2147484544 */
+                    UNS8 CANOpenShellMasterOD_obj1447_Transmission_Type = 0xFF;	/* 255 */
+                    UNS16 CANOpenShellMasterOD_obj1447_Inhibit_Time = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1447_Compatibility_Entry = 0x0;	/* 0 */
+                    UNS16 CANOpenShellMasterOD_obj1447_Event_Timer = 0x0;	/* 0 */
+                    UNS8 CANOpenShellMasterOD_obj1447_SYNC_start_value = 0x0;	/* 0 */
+                    subindex CANOpenShellMasterOD_Index1447[] = 
+                     {
+                       { RO, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1447, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1447_COB_ID_used_by_PDO, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1447_Transmission_Type, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1447_Inhibit_Time, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1447_Compatibility_Entry, NULL },
+                       { RW, uint16, sizeof (UNS16), (void*)&CANOpenShellMasterOD_obj1447_Event_Timer, NULL },
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_obj1447_SYNC_start_value, NULL }
+                     };
+
 /* index 0x1600 :   Receive PDO 1 Mapping. */
                     UNS8 CANOpenShellMasterOD_highestSubIndex_obj1600 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1600[] = 
@@ -2431,183 +3457,1047 @@ $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$
                      };
 
 /* index 0x1606 :   Receive PDO 7 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1606 = 2; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1606 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1606[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x60630020	/* 1617100832 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index1606[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1606, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1606[0], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1606[1], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1606[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1606[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1606[3], NULL }
                      };
 
 /* index 0x1607 :   Receive PDO 8 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1607 = 2; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1607 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1607[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x60630020	/* 1617100832 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index1607[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1607, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1607[0], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1607[1], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1607[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1607[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1607[3], NULL }
                      };
 
 /* index 0x1608 :   Receive PDO 9 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1608 = 2; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1608 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1608[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x60630020	/* 1617100832 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index1608[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1608, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1608[0], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1608[1], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1608[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1608[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1608[3], NULL }
                      };
 
 /* index 0x1609 :   Receive PDO 10 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1609 = 2; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1609 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1609[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x60630020	/* 1617100832 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index1609[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1609, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1609[0], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1609[1], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1609[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1609[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1609[3], NULL }
                      };
 
 /* index 0x160A :   Receive PDO 11 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160A = 2; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160A = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj160A[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x60630020	/* 1617100832 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index160A[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj160A, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160A[0], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160A[1], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160A[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160A[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160A[3], NULL }
                      };
 
 /* index 0x160B :   Receive PDO 12 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160B = 2; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160B = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj160B[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x60630020	/* 1617100832 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index160B[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj160B, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160B[0], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160B[1], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160B[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160B[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160B[3], NULL }
                      };
 
 /* index 0x160C :   Receive PDO 13 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160C = 3; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160C = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj160C[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x23040110,	/* 587464976 */
-                      0x23040310	/* 587465488 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index160C[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj160C, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160C[0], NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160C[1], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160C[2], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160C[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160C[3], NULL }
                      };
 
 /* index 0x160D :   Receive PDO 14 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160D = 3; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160D = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj160D[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x23040110,	/* 587464976 */
-                      0x23040310	/* 587465488 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index160D[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj160D, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160D[0], NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160D[1], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160D[2], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160D[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160D[3], NULL }
                      };
 
 /* index 0x160E :   Receive PDO 15 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160E = 3; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160E = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj160E[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x23040110,	/* 587464976 */
-                      0x23040310	/* 587465488 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index160E[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj160E, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160E[0], NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160E[1], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160E[2], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160E[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160E[3], NULL }
                      };
 
 /* index 0x160F :   Receive PDO 16 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160F = 3; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj160F = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj160F[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x23040110,	/* 587464976 */
-                      0x23040310	/* 587465488 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index160F[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj160F, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160F[0], NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160F[1], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160F[2], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160F[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj160F[3], NULL }
                      };
 
 /* index 0x1610 :   Receive PDO 17 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1610 = 3; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1610 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1610[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x23040110,	/* 587464976 */
-                      0x23040310	/* 587465488 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index1610[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1610, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1610[0], NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1610[1], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1610[2], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1610[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1610[3], NULL }
                      };
 
 /* index 0x1611 :   Receive PDO 18 Mapping. */
-                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1611 = 3; /* number of subindex - 1*/
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1611 = 4; /* number of subindex - 1*/
                     UNS32 CANOpenShellMasterOD_obj1611[] = 
                     {
                       0x20000008,	/* 536870920 */
-                      0x23040110,	/* 587464976 */
-                      0x23040310	/* 587465488 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
                     };
                     subindex CANOpenShellMasterOD_Index1611[] = 
                      {
                        { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1611, NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1611[0], NULL },
                        { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1611[1], NULL },
-                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1611[2], NULL }
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1611[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1611[3], NULL }
+                     };
+
+/* index 0x1612 :   Receive PDO 19 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1612 = 4; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1612[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1612[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1612, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1612[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1612[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1612[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1612[3], NULL }
+                     };
+
+/* index 0x1613 :   Receive PDO 20 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1613 = 4; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1613[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1613[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1613, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1613[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1613[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1613[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1613[3], NULL }
+                     };
+
+/* index 0x1614 :   Receive PDO 21 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1614 = 4; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1614[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1614[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1614, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1614[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1614[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1614[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1614[3], NULL }
+                     };
+
+/* index 0x1615 :   Receive PDO 22 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1615 = 4; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1615[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1615[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1615, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1615[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1615[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1615[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1615[3], NULL }
+                     };
+
+/* index 0x1616 :   Receive PDO 23 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1616 = 4; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1616[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1616[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1616, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1616[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1616[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1616[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1616[3], NULL }
+                     };
+
+/* index 0x1617 :   Receive PDO 24 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1617 = 4; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1617[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60410010,	/* 1614872592 */
+                      0x24000010,	/* 603979792 */
+                      0x60610008	/* 1616969736 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1617[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1617, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1617[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1617[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1617[2], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1617[3], NULL }
+                     };
+
+/* index 0x1618 :   Receive PDO 25 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1618 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1618[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1618[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1618, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1618[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1618[1], NULL }
+                     };
+
+/* index 0x1619 :   Receive PDO 26 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1619 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1619[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1619[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1619, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1619[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1619[1], NULL }
+                     };
+
+/* index 0x161A :   Receive PDO 27 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj161A = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj161A[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index161A[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj161A, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161A[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161A[1], NULL }
+                     };
+
+/* index 0x161B :   Receive PDO 28 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj161B = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj161B[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index161B[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj161B, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161B[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161B[1], NULL }
+                     };
+
+/* index 0x161C :   Receive PDO 29 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj161C = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj161C[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index161C[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj161C, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161C[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161C[1], NULL }
+                     };
+
+/* index 0x161D :   Receive PDO 30 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj161D = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj161D[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index161D[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj161D, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161D[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161D[1], NULL }
+                     };
+
+/* index 0x161E :   Receive PDO 31 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj161E = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj161E[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index161E[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj161E, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161E[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161E[1], NULL }
+                     };
+
+/* index 0x161F :   Receive PDO 32 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj161F = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj161F[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index161F[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj161F, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161F[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj161F[1], NULL }
+                     };
+
+/* index 0x1620 :   Receive PDO 33 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1620 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1620[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1620[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1620, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1620[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1620[1], NULL }
+                     };
+
+/* index 0x1621 :   Receive PDO 34 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1621 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1621[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1621[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1621, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1621[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1621[1], NULL }
+                     };
+
+/* index 0x1622 :   Receive PDO 35 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1622 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1622[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1622[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1622, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1622[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1622[1], NULL }
+                     };
+
+/* index 0x1623 :   Receive PDO 36 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1623 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1623[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1623[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1623, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1623[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1623[1], NULL }
+                     };
+
+/* index 0x1624 :   Receive PDO 37 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1624 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1624[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1624[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1624, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1624[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1624[1], NULL }
+                     };
+
+/* index 0x1625 :   Receive PDO 38 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1625 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1625[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1625[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1625, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1625[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1625[1], NULL }
+                     };
+
+/* index 0x1626 :   Receive PDO 39 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1626 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1626[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1626[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1626, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1626[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1626[1], NULL }
+                     };
+
+/* index 0x1627 :   Receive PDO 40 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1627 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1627[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1627[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1627, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1627[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1627[1], NULL }
+                     };
+
+/* index 0x1628 :   Receive PDO 41 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1628 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1628[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1628[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1628, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1628[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1628[1], NULL }
+                     };
+
+/* index 0x1629 :   Receive PDO 42 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1629 = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1629[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1629[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1629, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1629[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1629[1], NULL }
+                     };
+
+/* index 0x162A :   Receive PDO 43 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj162A = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj162A[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index162A[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj162A, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162A[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162A[1], NULL }
+                     };
+
+/* index 0x162B :   Receive PDO 44 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj162B = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj162B[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index162B[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj162B, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162B[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162B[1], NULL }
+                     };
+
+/* index 0x162C :   Receive PDO 45 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj162C = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj162C[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index162C[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj162C, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162C[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162C[1], NULL }
+                     };
+
+/* index 0x162D :   Receive PDO 46 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj162D = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj162D[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index162D[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj162D, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162D[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162D[1], NULL }
+                     };
+
+/* index 0x162E :   Receive PDO 47 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj162E = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj162E[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index162E[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj162E, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162E[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162E[1], NULL }
+                     };
+
+/* index 0x162F :   Receive PDO 48 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj162F = 2; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj162F[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x60630020	/* 1617100832 */
+                    };
+                    subindex CANOpenShellMasterOD_Index162F[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj162F, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162F[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj162F[1], NULL }
+                     };
+
+/* index 0x1630 :   Receive PDO 49 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1630 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1630[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1630[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1630, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1630[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1630[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1630[2], NULL }
+                     };
+
+/* index 0x1631 :   Receive PDO 50 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1631 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1631[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1631[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1631, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1631[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1631[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1631[2], NULL }
+                     };
+
+/* index 0x1632 :   Receive PDO 51 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1632 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1632[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1632[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1632, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1632[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1632[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1632[2], NULL }
+                     };
+
+/* index 0x1633 :   Receive PDO 52 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1633 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1633[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1633[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1633, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1633[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1633[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1633[2], NULL }
+                     };
+
+/* index 0x1634 :   Receive PDO 53 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1634 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1634[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1634[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1634, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1634[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1634[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1634[2], NULL }
+                     };
+
+/* index 0x1635 :   Receive PDO 54 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1635 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1635[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1635[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1635, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1635[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1635[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1635[2], NULL }
+                     };
+
+/* index 0x1636 :   Receive PDO 55 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1636 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1636[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1636[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1636, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1636[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1636[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1636[2], NULL }
+                     };
+
+/* index 0x1637 :   Receive PDO 56 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1637 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1637[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1637[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1637, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1637[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1637[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1637[2], NULL }
+                     };
+
+/* index 0x1638 :   Receive PDO 57 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1638 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1638[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1638[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1638, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1638[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1638[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1638[2], NULL }
+                     };
+
+/* index 0x1639 :   Receive PDO 58 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1639 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1639[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1639[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1639, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1639[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1639[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1639[2], NULL }
+                     };
+
+/* index 0x163A :   Receive PDO 59 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj163A = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj163A[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index163A[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj163A, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163A[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163A[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163A[2], NULL }
+                     };
+
+/* index 0x163B :   Receive PDO 60 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj163B = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj163B[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index163B[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj163B, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163B[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163B[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163B[2], NULL }
+                     };
+
+/* index 0x163C :   Receive PDO 61 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj163C = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj163C[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index163C[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj163C, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163C[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163C[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163C[2], NULL }
+                     };
+
+/* index 0x163D :   Receive PDO 62 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj163D = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj163D[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index163D[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj163D, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163D[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163D[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163D[2], NULL }
+                     };
+
+/* index 0x163E :   Receive PDO 63 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj163E = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj163E[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index163E[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj163E, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163E[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163E[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163E[2], NULL }
+                     };
+
+/* index 0x163F :   Receive PDO 64 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj163F = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj163F[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index163F[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj163F, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163F[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163F[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj163F[2], NULL }
+                     };
+
+/* index 0x1640 :   Receive PDO 65 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1640 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1640[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1640[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1640, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1640[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1640[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1640[2], NULL }
+                     };
+
+/* index 0x1641 :   Receive PDO 66 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1641 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1641[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1641[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1641, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1641[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1641[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1641[2], NULL }
+                     };
+
+/* index 0x1642 :   Receive PDO 67 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1642 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1642[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1642[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1642, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1642[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1642[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1642[2], NULL }
+                     };
+
+/* index 0x1643 :   Receive PDO 68 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1643 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1643[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1643[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1643, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1643[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1643[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1643[2], NULL }
+                     };
+
+/* index 0x1644 :   Receive PDO 69 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1644 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1644[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1644[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1644, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1644[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1644[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1644[2], NULL }
+                     };
+
+/* index 0x1645 :   Receive PDO 70 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1645 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1645[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1645[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1645, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1645[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1645[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1645[2], NULL }
+                     };
+
+/* index 0x1646 :   Receive PDO 71 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1646 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1646[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1646[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1646, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1646[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1646[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1646[2], NULL }
+                     };
+
+/* index 0x1647 :   Receive PDO 72 Mapping. */
+                    UNS8 CANOpenShellMasterOD_highestSubIndex_obj1647 = 3; /* number of subindex - 1*/
+                    UNS32 CANOpenShellMasterOD_obj1647[] = 
+                    {
+                      0x20000008,	/* 536870920 */
+                      0x23040110,	/* 587464976 */
+                      0x23040310	/* 587465488 */
+                    };
+                    subindex CANOpenShellMasterOD_Index1647[] = 
+                     {
+                       { RW, uint8, sizeof (UNS8), (void*)&CANOpenShellMasterOD_highestSubIndex_obj1647, NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1647[0], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1647[1], NULL },
+                       { RW, uint32, sizeof (UNS32), (void*)&CANOpenShellMasterOD_obj1647[2], NULL }
                      };
 
 /* index 0x1800 :   Transmit PDO 1 Parameter. */
@@ -3847,6 +5737,60 @@ const indextable CANOpenShellMasterOD_objdict[] =
   { (subindex*)CANOpenShellMasterOD_Index140F,sizeof(CANOpenShellMasterOD_Index140F)/sizeof(CANOpenShellMasterOD_Index140F[0]), 0x140F},
   { (subindex*)CANOpenShellMasterOD_Index1410,sizeof(CANOpenShellMasterOD_Index1410)/sizeof(CANOpenShellMasterOD_Index1410[0]), 0x1410},
   { (subindex*)CANOpenShellMasterOD_Index1411,sizeof(CANOpenShellMasterOD_Index1411)/sizeof(CANOpenShellMasterOD_Index1411[0]), 0x1411},
+  { (subindex*)CANOpenShellMasterOD_Index1412,sizeof(CANOpenShellMasterOD_Index1412)/sizeof(CANOpenShellMasterOD_Index1412[0]), 0x1412},
+  { (subindex*)CANOpenShellMasterOD_Index1413,sizeof(CANOpenShellMasterOD_Index1413)/sizeof(CANOpenShellMasterOD_Index1413[0]), 0x1413},
+  { (subindex*)CANOpenShellMasterOD_Index1414,sizeof(CANOpenShellMasterOD_Index1414)/sizeof(CANOpenShellMasterOD_Index1414[0]), 0x1414},
+  { (subindex*)CANOpenShellMasterOD_Index1415,sizeof(CANOpenShellMasterOD_Index1415)/sizeof(CANOpenShellMasterOD_Index1415[0]), 0x1415},
+  { (subindex*)CANOpenShellMasterOD_Index1416,sizeof(CANOpenShellMasterOD_Index1416)/sizeof(CANOpenShellMasterOD_Index1416[0]), 0x1416},
+  { (subindex*)CANOpenShellMasterOD_Index1417,sizeof(CANOpenShellMasterOD_Index1417)/sizeof(CANOpenShellMasterOD_Index1417[0]), 0x1417},
+  { (subindex*)CANOpenShellMasterOD_Index1418,sizeof(CANOpenShellMasterOD_Index1418)/sizeof(CANOpenShellMasterOD_Index1418[0]), 0x1418},
+  { (subindex*)CANOpenShellMasterOD_Index1419,sizeof(CANOpenShellMasterOD_Index1419)/sizeof(CANOpenShellMasterOD_Index1419[0]), 0x1419},
+  { (subindex*)CANOpenShellMasterOD_Index141A,sizeof(CANOpenShellMasterOD_Index141A)/sizeof(CANOpenShellMasterOD_Index141A[0]), 0x141A},
+  { (subindex*)CANOpenShellMasterOD_Index141B,sizeof(CANOpenShellMasterOD_Index141B)/sizeof(CANOpenShellMasterOD_Index141B[0]), 0x141B},
+  { (subindex*)CANOpenShellMasterOD_Index141C,sizeof(CANOpenShellMasterOD_Index141C)/sizeof(CANOpenShellMasterOD_Index141C[0]), 0x141C},
+  { (subindex*)CANOpenShellMasterOD_Index141D,sizeof(CANOpenShellMasterOD_Index141D)/sizeof(CANOpenShellMasterOD_Index141D[0]), 0x141D},
+  { (subindex*)CANOpenShellMasterOD_Index141E,sizeof(CANOpenShellMasterOD_Index141E)/sizeof(CANOpenShellMasterOD_Index141E[0]), 0x141E},
+  { (subindex*)CANOpenShellMasterOD_Index141F,sizeof(CANOpenShellMasterOD_Index141F)/sizeof(CANOpenShellMasterOD_Index141F[0]), 0x141F},
+  { (subindex*)CANOpenShellMasterOD_Index1420,sizeof(CANOpenShellMasterOD_Index1420)/sizeof(CANOpenShellMasterOD_Index1420[0]), 0x1420},
+  { (subindex*)CANOpenShellMasterOD_Index1421,sizeof(CANOpenShellMasterOD_Index1421)/sizeof(CANOpenShellMasterOD_Index1421[0]), 0x1421},
+  { (subindex*)CANOpenShellMasterOD_Index1422,sizeof(CANOpenShellMasterOD_Index1422)/sizeof(CANOpenShellMasterOD_Index1422[0]), 0x1422},
+  { (subindex*)CANOpenShellMasterOD_Index1423,sizeof(CANOpenShellMasterOD_Index1423)/sizeof(CANOpenShellMasterOD_Index1423[0]), 0x1423},
+  { (subindex*)CANOpenShellMasterOD_Index1424,sizeof(CANOpenShellMasterOD_Index1424)/sizeof(CANOpenShellMasterOD_Index1424[0]), 0x1424},
+  { (subindex*)CANOpenShellMasterOD_Index1425,sizeof(CANOpenShellMasterOD_Index1425)/sizeof(CANOpenShellMasterOD_Index1425[0]), 0x1425},
+  { (subindex*)CANOpenShellMasterOD_Index1426,sizeof(CANOpenShellMasterOD_Index1426)/sizeof(CANOpenShellMasterOD_Index1426[0]), 0x1426},
+  { (subindex*)CANOpenShellMasterOD_Index1427,sizeof(CANOpenShellMasterOD_Index1427)/sizeof(CANOpenShellMasterOD_Index1427[0]), 0x1427},
+  { (subindex*)CANOpenShellMasterOD_Index1428,sizeof(CANOpenShellMasterOD_Index1428)/sizeof(CANOpenShellMasterOD_Index1428[0]), 0x1428},
+  { (subindex*)CANOpenShellMasterOD_Index1429,sizeof(CANOpenShellMasterOD_Index1429)/sizeof(CANOpenShellMasterOD_Index1429[0]), 0x1429},
+  { (subindex*)CANOpenShellMasterOD_Index142A,sizeof(CANOpenShellMasterOD_Index142A)/sizeof(CANOpenShellMasterOD_Index142A[0]), 0x142A},
+  { (subindex*)CANOpenShellMasterOD_Index142B,sizeof(CANOpenShellMasterOD_Index142B)/sizeof(CANOpenShellMasterOD_Index142B[0]), 0x142B},
+  { (subindex*)CANOpenShellMasterOD_Index142C,sizeof(CANOpenShellMasterOD_Index142C)/sizeof(CANOpenShellMasterOD_Index142C[0]), 0x142C},
+  { (subindex*)CANOpenShellMasterOD_Index142D,sizeof(CANOpenShellMasterOD_Index142D)/sizeof(CANOpenShellMasterOD_Index142D[0]), 0x142D},
+  { (subindex*)CANOpenShellMasterOD_Index142E,sizeof(CANOpenShellMasterOD_Index142E)/sizeof(CANOpenShellMasterOD_Index142E[0]), 0x142E},
+  { (subindex*)CANOpenShellMasterOD_Index142F,sizeof(CANOpenShellMasterOD_Index142F)/sizeof(CANOpenShellMasterOD_Index142F[0]), 0x142F},
+  { (subindex*)CANOpenShellMasterOD_Index1430,sizeof(CANOpenShellMasterOD_Index1430)/sizeof(CANOpenShellMasterOD_Index1430[0]), 0x1430},
+  { (subindex*)CANOpenShellMasterOD_Index1431,sizeof(CANOpenShellMasterOD_Index1431)/sizeof(CANOpenShellMasterOD_Index1431[0]), 0x1431},
+  { (subindex*)CANOpenShellMasterOD_Index1432,sizeof(CANOpenShellMasterOD_Index1432)/sizeof(CANOpenShellMasterOD_Index1432[0]), 0x1432},
+  { (subindex*)CANOpenShellMasterOD_Index1433,sizeof(CANOpenShellMasterOD_Index1433)/sizeof(CANOpenShellMasterOD_Index1433[0]), 0x1433},
+  { (subindex*)CANOpenShellMasterOD_Index1434,sizeof(CANOpenShellMasterOD_Index1434)/sizeof(CANOpenShellMasterOD_Index1434[0]), 0x1434},
+  { (subindex*)CANOpenShellMasterOD_Index1435,sizeof(CANOpenShellMasterOD_Index1435)/sizeof(CANOpenShellMasterOD_Index1435[0]), 0x1435},
+  { (subindex*)CANOpenShellMasterOD_Index1436,sizeof(CANOpenShellMasterOD_Index1436)/sizeof(CANOpenShellMasterOD_Index1436[0]), 0x1436},
+  { (subindex*)CANOpenShellMasterOD_Index1437,sizeof(CANOpenShellMasterOD_Index1437)/sizeof(CANOpenShellMasterOD_Index1437[0]), 0x1437},
+  { (subindex*)CANOpenShellMasterOD_Index1438,sizeof(CANOpenShellMasterOD_Index1438)/sizeof(CANOpenShellMasterOD_Index1438[0]), 0x1438},
+  { (subindex*)CANOpenShellMasterOD_Index1439,sizeof(CANOpenShellMasterOD_Index1439)/sizeof(CANOpenShellMasterOD_Index1439[0]), 0x1439},
+  { (subindex*)CANOpenShellMasterOD_Index143A,sizeof(CANOpenShellMasterOD_Index143A)/sizeof(CANOpenShellMasterOD_Index143A[0]), 0x143A},
+  { (subindex*)CANOpenShellMasterOD_Index143B,sizeof(CANOpenShellMasterOD_Index143B)/sizeof(CANOpenShellMasterOD_Index143B[0]), 0x143B},
+  { (subindex*)CANOpenShellMasterOD_Index143C,sizeof(CANOpenShellMasterOD_Index143C)/sizeof(CANOpenShellMasterOD_Index143C[0]), 0x143C},
+  { (subindex*)CANOpenShellMasterOD_Index143D,sizeof(CANOpenShellMasterOD_Index143D)/sizeof(CANOpenShellMasterOD_Index143D[0]), 0x143D},
+  { (subindex*)CANOpenShellMasterOD_Index143E,sizeof(CANOpenShellMasterOD_Index143E)/sizeof(CANOpenShellMasterOD_Index143E[0]), 0x143E},
+  { (subindex*)CANOpenShellMasterOD_Index143F,sizeof(CANOpenShellMasterOD_Index143F)/sizeof(CANOpenShellMasterOD_Index143F[0]), 0x143F},
+  { (subindex*)CANOpenShellMasterOD_Index1440,sizeof(CANOpenShellMasterOD_Index1440)/sizeof(CANOpenShellMasterOD_Index1440[0]), 0x1440},
+  { (subindex*)CANOpenShellMasterOD_Index1441,sizeof(CANOpenShellMasterOD_Index1441)/sizeof(CANOpenShellMasterOD_Index1441[0]), 0x1441},
+  { (subindex*)CANOpenShellMasterOD_Index1442,sizeof(CANOpenShellMasterOD_Index1442)/sizeof(CANOpenShellMasterOD_Index1442[0]), 0x1442},
+  { (subindex*)CANOpenShellMasterOD_Index1443,sizeof(CANOpenShellMasterOD_Index1443)/sizeof(CANOpenShellMasterOD_Index1443[0]), 0x1443},
+  { (subindex*)CANOpenShellMasterOD_Index1444,sizeof(CANOpenShellMasterOD_Index1444)/sizeof(CANOpenShellMasterOD_Index1444[0]), 0x1444},
+  { (subindex*)CANOpenShellMasterOD_Index1445,sizeof(CANOpenShellMasterOD_Index1445)/sizeof(CANOpenShellMasterOD_Index1445[0]), 0x1445},
+  { (subindex*)CANOpenShellMasterOD_Index1446,sizeof(CANOpenShellMasterOD_Index1446)/sizeof(CANOpenShellMasterOD_Index1446[0]), 0x1446},
+  { (subindex*)CANOpenShellMasterOD_Index1447,sizeof(CANOpenShellMasterOD_Index1447)/sizeof(CANOpenShellMasterOD_Index1447[0]), 0x1447},
   { (subindex*)CANOpenShellMasterOD_Index1600,sizeof(CANOpenShellMasterOD_Index1600)/sizeof(CANOpenShellMasterOD_Index1600[0]), 0x1600},
   { (subindex*)CANOpenShellMasterOD_Index1601,sizeof(CANOpenShellMasterOD_Index1601)/sizeof(CANOpenShellMasterOD_Index1601[0]), 0x1601},
   { (subindex*)CANOpenShellMasterOD_Index1602,sizeof(CANOpenShellMasterOD_Index1602)/sizeof(CANOpenShellMasterOD_Index1602[0]), 0x1602},
@@ -3865,6 +5809,60 @@ const indextable CANOpenShellMasterOD_objdict[] =
   { (subindex*)CANOpenShellMasterOD_Index160F,sizeof(CANOpenShellMasterOD_Index160F)/sizeof(CANOpenShellMasterOD_Index160F[0]), 0x160F},
   { (subindex*)CANOpenShellMasterOD_Index1610,sizeof(CANOpenShellMasterOD_Index1610)/sizeof(CANOpenShellMasterOD_Index1610[0]), 0x1610},
   { (subindex*)CANOpenShellMasterOD_Index1611,sizeof(CANOpenShellMasterOD_Index1611)/sizeof(CANOpenShellMasterOD_Index1611[0]), 0x1611},
+  { (subindex*)CANOpenShellMasterOD_Index1612,sizeof(CANOpenShellMasterOD_Index1612)/sizeof(CANOpenShellMasterOD_Index1612[0]), 0x1612},
+  { (subindex*)CANOpenShellMasterOD_Index1613,sizeof(CANOpenShellMasterOD_Index1613)/sizeof(CANOpenShellMasterOD_Index1613[0]), 0x1613},
+  { (subindex*)CANOpenShellMasterOD_Index1614,sizeof(CANOpenShellMasterOD_Index1614)/sizeof(CANOpenShellMasterOD_Index1614[0]), 0x1614},
+  { (subindex*)CANOpenShellMasterOD_Index1615,sizeof(CANOpenShellMasterOD_Index1615)/sizeof(CANOpenShellMasterOD_Index1615[0]), 0x1615},
+  { (subindex*)CANOpenShellMasterOD_Index1616,sizeof(CANOpenShellMasterOD_Index1616)/sizeof(CANOpenShellMasterOD_Index1616[0]), 0x1616},
+  { (subindex*)CANOpenShellMasterOD_Index1617,sizeof(CANOpenShellMasterOD_Index1617)/sizeof(CANOpenShellMasterOD_Index1617[0]), 0x1617},
+  { (subindex*)CANOpenShellMasterOD_Index1618,sizeof(CANOpenShellMasterOD_Index1618)/sizeof(CANOpenShellMasterOD_Index1618[0]), 0x1618},
+  { (subindex*)CANOpenShellMasterOD_Index1619,sizeof(CANOpenShellMasterOD_Index1619)/sizeof(CANOpenShellMasterOD_Index1619[0]), 0x1619},
+  { (subindex*)CANOpenShellMasterOD_Index161A,sizeof(CANOpenShellMasterOD_Index161A)/sizeof(CANOpenShellMasterOD_Index161A[0]), 0x161A},
+  { (subindex*)CANOpenShellMasterOD_Index161B,sizeof(CANOpenShellMasterOD_Index161B)/sizeof(CANOpenShellMasterOD_Index161B[0]), 0x161B},
+  { (subindex*)CANOpenShellMasterOD_Index161C,sizeof(CANOpenShellMasterOD_Index161C)/sizeof(CANOpenShellMasterOD_Index161C[0]), 0x161C},
+  { (subindex*)CANOpenShellMasterOD_Index161D,sizeof(CANOpenShellMasterOD_Index161D)/sizeof(CANOpenShellMasterOD_Index161D[0]), 0x161D},
+  { (subindex*)CANOpenShellMasterOD_Index161E,sizeof(CANOpenShellMasterOD_Index161E)/sizeof(CANOpenShellMasterOD_Index161E[0]), 0x161E},
+  { (subindex*)CANOpenShellMasterOD_Index161F,sizeof(CANOpenShellMasterOD_Index161F)/sizeof(CANOpenShellMasterOD_Index161F[0]), 0x161F},
+  { (subindex*)CANOpenShellMasterOD_Index1620,sizeof(CANOpenShellMasterOD_Index1620)/sizeof(CANOpenShellMasterOD_Index1620[0]), 0x1620},
+  { (subindex*)CANOpenShellMasterOD_Index1621,sizeof(CANOpenShellMasterOD_Index1621)/sizeof(CANOpenShellMasterOD_Index1621[0]), 0x1621},
+  { (subindex*)CANOpenShellMasterOD_Index1622,sizeof(CANOpenShellMasterOD_Index1622)/sizeof(CANOpenShellMasterOD_Index1622[0]), 0x1622},
+  { (subindex*)CANOpenShellMasterOD_Index1623,sizeof(CANOpenShellMasterOD_Index1623)/sizeof(CANOpenShellMasterOD_Index1623[0]), 0x1623},
+  { (subindex*)CANOpenShellMasterOD_Index1624,sizeof(CANOpenShellMasterOD_Index1624)/sizeof(CANOpenShellMasterOD_Index1624[0]), 0x1624},
+  { (subindex*)CANOpenShellMasterOD_Index1625,sizeof(CANOpenShellMasterOD_Index1625)/sizeof(CANOpenShellMasterOD_Index1625[0]), 0x1625},
+  { (subindex*)CANOpenShellMasterOD_Index1626,sizeof(CANOpenShellMasterOD_Index1626)/sizeof(CANOpenShellMasterOD_Index1626[0]), 0x1626},
+  { (subindex*)CANOpenShellMasterOD_Index1627,sizeof(CANOpenShellMasterOD_Index1627)/sizeof(CANOpenShellMasterOD_Index1627[0]), 0x1627},
+  { (subindex*)CANOpenShellMasterOD_Index1628,sizeof(CANOpenShellMasterOD_Index1628)/sizeof(CANOpenShellMasterOD_Index1628[0]), 0x1628},
+  { (subindex*)CANOpenShellMasterOD_Index1629,sizeof(CANOpenShellMasterOD_Index1629)/sizeof(CANOpenShellMasterOD_Index1629[0]), 0x1629},
+  { (subindex*)CANOpenShellMasterOD_Index162A,sizeof(CANOpenShellMasterOD_Index162A)/sizeof(CANOpenShellMasterOD_Index162A[0]), 0x162A},
+  { (subindex*)CANOpenShellMasterOD_Index162B,sizeof(CANOpenShellMasterOD_Index162B)/sizeof(CANOpenShellMasterOD_Index162B[0]), 0x162B},
+  { (subindex*)CANOpenShellMasterOD_Index162C,sizeof(CANOpenShellMasterOD_Index162C)/sizeof(CANOpenShellMasterOD_Index162C[0]), 0x162C},
+  { (subindex*)CANOpenShellMasterOD_Index162D,sizeof(CANOpenShellMasterOD_Index162D)/sizeof(CANOpenShellMasterOD_Index162D[0]), 0x162D},
+  { (subindex*)CANOpenShellMasterOD_Index162E,sizeof(CANOpenShellMasterOD_Index162E)/sizeof(CANOpenShellMasterOD_Index162E[0]), 0x162E},
+  { (subindex*)CANOpenShellMasterOD_Index162F,sizeof(CANOpenShellMasterOD_Index162F)/sizeof(CANOpenShellMasterOD_Index162F[0]), 0x162F},
+  { (subindex*)CANOpenShellMasterOD_Index1630,sizeof(CANOpenShellMasterOD_Index1630)/sizeof(CANOpenShellMasterOD_Index1630[0]), 0x1630},
+  { (subindex*)CANOpenShellMasterOD_Index1631,sizeof(CANOpenShellMasterOD_Index1631)/sizeof(CANOpenShellMasterOD_Index1631[0]), 0x1631},
+  { (subindex*)CANOpenShellMasterOD_Index1632,sizeof(CANOpenShellMasterOD_Index1632)/sizeof(CANOpenShellMasterOD_Index1632[0]), 0x1632},
+  { (subindex*)CANOpenShellMasterOD_Index1633,sizeof(CANOpenShellMasterOD_Index1633)/sizeof(CANOpenShellMasterOD_Index1633[0]), 0x1633},
+  { (subindex*)CANOpenShellMasterOD_Index1634,sizeof(CANOpenShellMasterOD_Index1634)/sizeof(CANOpenShellMasterOD_Index1634[0]), 0x1634},
+  { (subindex*)CANOpenShellMasterOD_Index1635,sizeof(CANOpenShellMasterOD_Index1635)/sizeof(CANOpenShellMasterOD_Index1635[0]), 0x1635},
+  { (subindex*)CANOpenShellMasterOD_Index1636,sizeof(CANOpenShellMasterOD_Index1636)/sizeof(CANOpenShellMasterOD_Index1636[0]), 0x1636},
+  { (subindex*)CANOpenShellMasterOD_Index1637,sizeof(CANOpenShellMasterOD_Index1637)/sizeof(CANOpenShellMasterOD_Index1637[0]), 0x1637},
+  { (subindex*)CANOpenShellMasterOD_Index1638,sizeof(CANOpenShellMasterOD_Index1638)/sizeof(CANOpenShellMasterOD_Index1638[0]), 0x1638},
+  { (subindex*)CANOpenShellMasterOD_Index1639,sizeof(CANOpenShellMasterOD_Index1639)/sizeof(CANOpenShellMasterOD_Index1639[0]), 0x1639},
+  { (subindex*)CANOpenShellMasterOD_Index163A,sizeof(CANOpenShellMasterOD_Index163A)/sizeof(CANOpenShellMasterOD_Index163A[0]), 0x163A},
+  { (subindex*)CANOpenShellMasterOD_Index163B,sizeof(CANOpenShellMasterOD_Index163B)/sizeof(CANOpenShellMasterOD_Index163B[0]), 0x163B},
+  { (subindex*)CANOpenShellMasterOD_Index163C,sizeof(CANOpenShellMasterOD_Index163C)/sizeof(CANOpenShellMasterOD_Index163C[0]), 0x163C},
+  { (subindex*)CANOpenShellMasterOD_Index163D,sizeof(CANOpenShellMasterOD_Index163D)/sizeof(CANOpenShellMasterOD_Index163D[0]), 0x163D},
+  { (subindex*)CANOpenShellMasterOD_Index163E,sizeof(CANOpenShellMasterOD_Index163E)/sizeof(CANOpenShellMasterOD_Index163E[0]), 0x163E},
+  { (subindex*)CANOpenShellMasterOD_Index163F,sizeof(CANOpenShellMasterOD_Index163F)/sizeof(CANOpenShellMasterOD_Index163F[0]), 0x163F},
+  { (subindex*)CANOpenShellMasterOD_Index1640,sizeof(CANOpenShellMasterOD_Index1640)/sizeof(CANOpenShellMasterOD_Index1640[0]), 0x1640},
+  { (subindex*)CANOpenShellMasterOD_Index1641,sizeof(CANOpenShellMasterOD_Index1641)/sizeof(CANOpenShellMasterOD_Index1641[0]), 0x1641},
+  { (subindex*)CANOpenShellMasterOD_Index1642,sizeof(CANOpenShellMasterOD_Index1642)/sizeof(CANOpenShellMasterOD_Index1642[0]), 0x1642},
+  { (subindex*)CANOpenShellMasterOD_Index1643,sizeof(CANOpenShellMasterOD_Index1643)/sizeof(CANOpenShellMasterOD_Index1643[0]), 0x1643},
+  { (subindex*)CANOpenShellMasterOD_Index1644,sizeof(CANOpenShellMasterOD_Index1644)/sizeof(CANOpenShellMasterOD_Index1644[0]), 0x1644},
+  { (subindex*)CANOpenShellMasterOD_Index1645,sizeof(CANOpenShellMasterOD_Index1645)/sizeof(CANOpenShellMasterOD_Index1645[0]), 0x1645},
+  { (subindex*)CANOpenShellMasterOD_Index1646,sizeof(CANOpenShellMasterOD_Index1646)/sizeof(CANOpenShellMasterOD_Index1646[0]), 0x1646},
+  { (subindex*)CANOpenShellMasterOD_Index1647,sizeof(CANOpenShellMasterOD_Index1647)/sizeof(CANOpenShellMasterOD_Index1647[0]), 0x1647},
   { (subindex*)CANOpenShellMasterOD_Index1800,sizeof(CANOpenShellMasterOD_Index1800)/sizeof(CANOpenShellMasterOD_Index1800[0]), 0x1800},
   { (subindex*)CANOpenShellMasterOD_Index1801,sizeof(CANOpenShellMasterOD_Index1801)/sizeof(CANOpenShellMasterOD_Index1801[0]), 0x1801},
   { (subindex*)CANOpenShellMasterOD_Index1802,sizeof(CANOpenShellMasterOD_Index1802)/sizeof(CANOpenShellMasterOD_Index1802[0]), 0x1802},
@@ -4129,123 +6127,231 @@ const indextable * CANOpenShellMasterOD_scanIndexOD (CO_Data *d, UNS16 wIndex, U
 		case 0x140F: i = 156;break;
 		case 0x1410: i = 157;break;
 		case 0x1411: i = 158;break;
-		case 0x1600: i = 159;break;
-		case 0x1601: i = 160;break;
-		case 0x1602: i = 161;break;
-		case 0x1603: i = 162;break;
-		case 0x1604: i = 163;break;
-		case 0x1605: i = 164;break;
-		case 0x1606: i = 165;break;
-		case 0x1607: i = 166;break;
-		case 0x1608: i = 167;break;
-		case 0x1609: i = 168;break;
-		case 0x160A: i = 169;break;
-		case 0x160B: i = 170;break;
-		case 0x160C: i = 171;break;
-		case 0x160D: i = 172;break;
-		case 0x160E: i = 173;break;
-		case 0x160F: i = 174;break;
-		case 0x1610: i = 175;break;
-		case 0x1611: i = 176;break;
-		case 0x1800: i = 177;break;
-		case 0x1801: i = 178;break;
-		case 0x1802: i = 179;break;
-		case 0x1803: i = 180;break;
-		case 0x1804: i = 181;break;
-		case 0x1805: i = 182;break;
-		case 0x1806: i = 183;break;
-		case 0x1807: i = 184;break;
-		case 0x1808: i = 185;break;
-		case 0x1809: i = 186;break;
-		case 0x180A: i = 187;break;
-		case 0x180B: i = 188;break;
-		case 0x180C: i = 189;break;
-		case 0x180D: i = 190;break;
-		case 0x180E: i = 191;break;
-		case 0x180F: i = 192;break;
-		case 0x1810: i = 193;break;
-		case 0x1811: i = 194;break;
-		case 0x1812: i = 195;break;
-		case 0x1A00: i = 196;break;
-		case 0x1A01: i = 197;break;
-		case 0x1A02: i = 198;break;
-		case 0x1A03: i = 199;break;
-		case 0x1A04: i = 200;break;
-		case 0x1A05: i = 201;break;
-		case 0x1A06: i = 202;break;
-		case 0x1A07: i = 203;break;
-		case 0x1A08: i = 204;break;
-		case 0x1A09: i = 205;break;
-		case 0x1A0A: i = 206;break;
-		case 0x1A0B: i = 207;break;
-		case 0x1A0C: i = 208;break;
-		case 0x1A0D: i = 209;break;
-		case 0x1A0E: i = 210;break;
-		case 0x1A0F: i = 211;break;
-		case 0x1A10: i = 212;break;
-		case 0x1A11: i = 213;break;
-		case 0x1A12: i = 214;break;
-		case 0x2000: i = 215;break;
-		case 0x2001: i = 216;break;
-		case 0x2100: i = 217;break;
-		case 0x2200: i = 218;break;
-		case 0x2201: i = 219;break;
-		case 0x2202: i = 220;break;
-		case 0x2300: i = 221;break;
-		case 0x2301: i = 222;break;
-		case 0x2302: i = 223;break;
-		case 0x2303: i = 224;break;
-		case 0x2304: i = 225;break;
-		case 0x2305: i = 226;break;
-		case 0x2306: i = 227;break;
-		case 0x2307: i = 228;break;
-		case 0x2400: i = 229;break;
-		case 0x2501: i = 230;break;
-		case 0x2502: i = 231;break;
-		case 0x2503: i = 232;break;
-		case 0x2504: i = 233;break;
-		case 0x2505: i = 234;break;
-		case 0x2600: i = 235;break;
-		case 0x6040: i = 236;break;
-		case 0x6041: i = 237;break;
-		case 0x605A: i = 238;break;
-		case 0x605D: i = 239;break;
-		case 0x6060: i = 240;break;
-		case 0x6061: i = 241;break;
-		case 0x6063: i = 242;break;
-		case 0x6065: i = 243;break;
-		case 0x606C: i = 244;break;
-		case 0x6071: i = 245;break;
-		case 0x6072: i = 246;break;
-		case 0x6073: i = 247;break;
-		case 0x607A: i = 248;break;
-		case 0x607C: i = 249;break;
-		case 0x607D: i = 250;break;
-		case 0x607E: i = 251;break;
-		case 0x607F: i = 252;break;
-		case 0x6081: i = 253;break;
-		case 0x6083: i = 254;break;
-		case 0x6085: i = 255;break;
-		case 0x608F: i = 256;break;
-		case 0x6098: i = 257;break;
-		case 0x6099: i = 258;break;
-		case 0x609A: i = 259;break;
-		case 0x60F4: i = 260;break;
-		case 0x60FB: i = 261;break;
-		case 0x60FD: i = 262;break;
-		case 0x60FE: i = 263;break;
-		case 0x60FF: i = 264;break;
-		case 0x6401: i = 265;break;
-		case 0x6402: i = 266;break;
-		case 0x6403: i = 267;break;
-		case 0x6404: i = 268;break;
-		case 0x6405: i = 269;break;
-		case 0x6502: i = 270;break;
-		case 0x6503: i = 271;break;
-		case 0x6504: i = 272;break;
-		case 0x6505: i = 273;break;
-		case 0x6510: i = 274;break;
-		case 0x67FF: i = 275;break;
+		case 0x1412: i = 159;break;
+		case 0x1413: i = 160;break;
+		case 0x1414: i = 161;break;
+		case 0x1415: i = 162;break;
+		case 0x1416: i = 163;break;
+		case 0x1417: i = 164;break;
+		case 0x1418: i = 165;break;
+		case 0x1419: i = 166;break;
+		case 0x141A: i = 167;break;
+		case 0x141B: i = 168;break;
+		case 0x141C: i = 169;break;
+		case 0x141D: i = 170;break;
+		case 0x141E: i = 171;break;
+		case 0x141F: i = 172;break;
+		case 0x1420: i = 173;break;
+		case 0x1421: i = 174;break;
+		case 0x1422: i = 175;break;
+		case 0x1423: i = 176;break;
+		case 0x1424: i = 177;break;
+		case 0x1425: i = 178;break;
+		case 0x1426: i = 179;break;
+		case 0x1427: i = 180;break;
+		case 0x1428: i = 181;break;
+		case 0x1429: i = 182;break;
+		case 0x142A: i = 183;break;
+		case 0x142B: i = 184;break;
+		case 0x142C: i = 185;break;
+		case 0x142D: i = 186;break;
+		case 0x142E: i = 187;break;
+		case 0x142F: i = 188;break;
+		case 0x1430: i = 189;break;
+		case 0x1431: i = 190;break;
+		case 0x1432: i = 191;break;
+		case 0x1433: i = 192;break;
+		case 0x1434: i = 193;break;
+		case 0x1435: i = 194;break;
+		case 0x1436: i = 195;break;
+		case 0x1437: i = 196;break;
+		case 0x1438: i = 197;break;
+		case 0x1439: i = 198;break;
+		case 0x143A: i = 199;break;
+		case 0x143B: i = 200;break;
+		case 0x143C: i = 201;break;
+		case 0x143D: i = 202;break;
+		case 0x143E: i = 203;break;
+		case 0x143F: i = 204;break;
+		case 0x1440: i = 205;break;
+		case 0x1441: i = 206;break;
+		case 0x1442: i = 207;break;
+		case 0x1443: i = 208;break;
+		case 0x1444: i = 209;break;
+		case 0x1445: i = 210;break;
+		case 0x1446: i = 211;break;
+		case 0x1447: i = 212;break;
+		case 0x1600: i = 213;break;
+		case 0x1601: i = 214;break;
+		case 0x1602: i = 215;break;
+		case 0x1603: i = 216;break;
+		case 0x1604: i = 217;break;
+		case 0x1605: i = 218;break;
+		case 0x1606: i = 219;break;
+		case 0x1607: i = 220;break;
+		case 0x1608: i = 221;break;
+		case 0x1609: i = 222;break;
+		case 0x160A: i = 223;break;
+		case 0x160B: i = 224;break;
+		case 0x160C: i = 225;break;
+		case 0x160D: i = 226;break;
+		case 0x160E: i = 227;break;
+		case 0x160F: i = 228;break;
+		case 0x1610: i = 229;break;
+		case 0x1611: i = 230;break;
+		case 0x1612: i = 231;break;
+		case 0x1613: i = 232;break;
+		case 0x1614: i = 233;break;
+		case 0x1615: i = 234;break;
+		case 0x1616: i = 235;break;
+		case 0x1617: i = 236;break;
+		case 0x1618: i = 237;break;
+		case 0x1619: i = 238;break;
+		case 0x161A: i = 239;break;
+		case 0x161B: i = 240;break;
+		case 0x161C: i = 241;break;
+		case 0x161D: i = 242;break;
+		case 0x161E: i = 243;break;
+		case 0x161F: i = 244;break;
+		case 0x1620: i = 245;break;
+		case 0x1621: i = 246;break;
+		case 0x1622: i = 247;break;
+		case 0x1623: i = 248;break;
+		case 0x1624: i = 249;break;
+		case 0x1625: i = 250;break;
+		case 0x1626: i = 251;break;
+		case 0x1627: i = 252;break;
+		case 0x1628: i = 253;break;
+		case 0x1629: i = 254;break;
+		case 0x162A: i = 255;break;
+		case 0x162B: i = 256;break;
+		case 0x162C: i = 257;break;
+		case 0x162D: i = 258;break;
+		case 0x162E: i = 259;break;
+		case 0x162F: i = 260;break;
+		case 0x1630: i = 261;break;
+		case 0x1631: i = 262;break;
+		case 0x1632: i = 263;break;
+		case 0x1633: i = 264;break;
+		case 0x1634: i = 265;break;
+		case 0x1635: i = 266;break;
+		case 0x1636: i = 267;break;
+		case 0x1637: i = 268;break;
+		case 0x1638: i = 269;break;
+		case 0x1639: i = 270;break;
+		case 0x163A: i = 271;break;
+		case 0x163B: i = 272;break;
+		case 0x163C: i = 273;break;
+		case 0x163D: i = 274;break;
+		case 0x163E: i = 275;break;
+		case 0x163F: i = 276;break;
+		case 0x1640: i = 277;break;
+		case 0x1641: i = 278;break;
+		case 0x1642: i = 279;break;
+		case 0x1643: i = 280;break;
+		case 0x1644: i = 281;break;
+		case 0x1645: i = 282;break;
+		case 0x1646: i = 283;break;
+		case 0x1647: i = 284;break;
+		case 0x1800: i = 285;break;
+		case 0x1801: i = 286;break;
+		case 0x1802: i = 287;break;
+		case 0x1803: i = 288;break;
+		case 0x1804: i = 289;break;
+		case 0x1805: i = 290;break;
+		case 0x1806: i = 291;break;
+		case 0x1807: i = 292;break;
+		case 0x1808: i = 293;break;
+		case 0x1809: i = 294;break;
+		case 0x180A: i = 295;break;
+		case 0x180B: i = 296;break;
+		case 0x180C: i = 297;break;
+		case 0x180D: i = 298;break;
+		case 0x180E: i = 299;break;
+		case 0x180F: i = 300;break;
+		case 0x1810: i = 301;break;
+		case 0x1811: i = 302;break;
+		case 0x1812: i = 303;break;
+		case 0x1A00: i = 304;break;
+		case 0x1A01: i = 305;break;
+		case 0x1A02: i = 306;break;
+		case 0x1A03: i = 307;break;
+		case 0x1A04: i = 308;break;
+		case 0x1A05: i = 309;break;
+		case 0x1A06: i = 310;break;
+		case 0x1A07: i = 311;break;
+		case 0x1A08: i = 312;break;
+		case 0x1A09: i = 313;break;
+		case 0x1A0A: i = 314;break;
+		case 0x1A0B: i = 315;break;
+		case 0x1A0C: i = 316;break;
+		case 0x1A0D: i = 317;break;
+		case 0x1A0E: i = 318;break;
+		case 0x1A0F: i = 319;break;
+		case 0x1A10: i = 320;break;
+		case 0x1A11: i = 321;break;
+		case 0x1A12: i = 322;break;
+		case 0x2000: i = 323;break;
+		case 0x2001: i = 324;break;
+		case 0x2100: i = 325;break;
+		case 0x2200: i = 326;break;
+		case 0x2201: i = 327;break;
+		case 0x2202: i = 328;break;
+		case 0x2300: i = 329;break;
+		case 0x2301: i = 330;break;
+		case 0x2302: i = 331;break;
+		case 0x2303: i = 332;break;
+		case 0x2304: i = 333;break;
+		case 0x2305: i = 334;break;
+		case 0x2306: i = 335;break;
+		case 0x2307: i = 336;break;
+		case 0x2400: i = 337;break;
+		case 0x2501: i = 338;break;
+		case 0x2502: i = 339;break;
+		case 0x2503: i = 340;break;
+		case 0x2504: i = 341;break;
+		case 0x2505: i = 342;break;
+		case 0x2600: i = 343;break;
+		case 0x6040: i = 344;break;
+		case 0x6041: i = 345;break;
+		case 0x605A: i = 346;break;
+		case 0x605D: i = 347;break;
+		case 0x6060: i = 348;break;
+		case 0x6061: i = 349;break;
+		case 0x6063: i = 350;break;
+		case 0x6065: i = 351;break;
+		case 0x606C: i = 352;break;
+		case 0x6071: i = 353;break;
+		case 0x6072: i = 354;break;
+		case 0x6073: i = 355;break;
+		case 0x607A: i = 356;break;
+		case 0x607C: i = 357;break;
+		case 0x607D: i = 358;break;
+		case 0x607E: i = 359;break;
+		case 0x607F: i = 360;break;
+		case 0x6081: i = 361;break;
+		case 0x6083: i = 362;break;
+		case 0x6085: i = 363;break;
+		case 0x608F: i = 364;break;
+		case 0x6098: i = 365;break;
+		case 0x6099: i = 366;break;
+		case 0x609A: i = 367;break;
+		case 0x60F4: i = 368;break;
+		case 0x60FB: i = 369;break;
+		case 0x60FD: i = 370;break;
+		case 0x60FE: i = 371;break;
+		case 0x60FF: i = 372;break;
+		case 0x6401: i = 373;break;
+		case 0x6402: i = 374;break;
+		case 0x6403: i = 375;break;
+		case 0x6404: i = 376;break;
+		case 0x6405: i = 377;break;
+		case 0x6502: i = 378;break;
+		case 0x6503: i = 379;break;
+		case 0x6504: i = 380;break;
+		case 0x6505: i = 381;break;
+		case 0x6510: i = 382;break;
+		case 0x67FF: i = 383;break;
 		default:
 			*errorCode = OD_NO_SUCH_OBJECT;
 			return NULL;
@@ -4265,18 +6371,18 @@ const quick_index CANOpenShellMasterOD_firstIndex = {
   0, /* SDO_SVR */
   14, /* SDO_CLT */
   141, /* PDO_RCV */
-  159, /* PDO_RCV_MAP */
-  177, /* PDO_TRS */
-  196 /* PDO_TRS_MAP */
+  213, /* PDO_RCV_MAP */
+  285, /* PDO_TRS */
+  304 /* PDO_TRS_MAP */
 };
 
 const quick_index CANOpenShellMasterOD_lastIndex = {
   0, /* SDO_SVR */
   140, /* SDO_CLT */
-  158, /* PDO_RCV */
-  176, /* PDO_RCV_MAP */
-  195, /* PDO_TRS */
-  214 /* PDO_TRS_MAP */
+  212, /* PDO_RCV */
+  284, /* PDO_RCV_MAP */
+  303, /* PDO_TRS */
+  322 /* PDO_TRS_MAP */
 };
 
 const UNS16 CANOpenShellMasterOD_ObjdictSize = sizeof(CANOpenShellMasterOD_objdict)/sizeof(CANOpenShellMasterOD_objdict[0]); 
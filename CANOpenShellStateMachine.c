@@ -1,11 +1,12 @@
-#include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <pthread.h>
 #include <time.h>
 #include <unistd.h>
 #include "CANOpenShellStateMachine.h"
 #include "CANOpenShellMasterError.h"
+#include "sdo_stats.h"
 
 int motor_active[CANOPEN_NODE_NUMBER]; /**< indica se un motore si è dichiarato */
 volatile int motor_started[CANOPEN_NODE_NUMBER];
@@ -19,128 +20,118 @@ UNS8 motor_mode[CANOPEN_NODE_NUMBER]; /**< ultimo stato del motore */
 
 int verbose_flag_state = 1;
 
-long next_machine_size[CANOPEN_NODE_NUMBER];
-struct state_machine_struct **next_machine[CANOPEN_NODE_NUMBER];
+/**
+ * Contesto di esecuzione di un motore. Viene allocato una volta per tutti i
+ * nodi, per cui avviare una macchina non richiede memoria dinamica e può
+ * essere fatto anche dal thread CAN con tempi prevedibili.
+ */
+struct machine_context
+{
+  struct state_machine_struct *machine[MACHINE_CHAIN_SIZE]; /**< macchine da eseguire in sequenza */
+  int machine_count; /**< macchine della sequenza, 0 se il motore è libero */
+  int machine_index; /**< macchina in esecuzione */
+  int step_index; /**< passi avviati della macchina in esecuzione */
+  uintptr_t args[MACHINE_ARGS_SIZE]; /**< argomenti della richiesta, valori o puntatori a stringa */
+  int arg_count;
+  int arg_index; /**< primo argomento non ancora usato */
+  struct machine_step step; /**< ultimo passo avviato, con gli argomenti già sostituiti */
+  UNS32 read_result; /**< valore letto dall'ultimo passo */
+  int read_done; /**< l'ultimo passo concluso è una lettura */
+  MachineCallback_t callback; /**< funzione chiamata alla fine della sequenza */
+  CO_Data *d; /**< nodo canopen della sequenza, per i passi inviati dallo scheduler */
+  int priority; /**< MACHINE_PRIORITY_xxx più alta tra le macchine della sequenza */
+  struct timespec step_time; /**< invio della richiesta SDO in corso */
+  int attempt; /**< tentativo in corso del passo, dal primo */
+  TIMER_HANDLE timer; /**< timeout della risposta o attesa prima di ripetere il passo */
+};
+
+static struct machine_context machine_context[CANOPEN_NODE_NUMBER];
 
-int next_var_count[CANOPEN_NODE_NUMBER];
-int var_count_total[CANOPEN_NODE_NUMBER];
-UNS32 *args_ptr[CANOPEN_NODE_NUMBER];
-UNS32 *next_args[CANOPEN_NODE_NUMBER];
+/**
+ * Richiesta in attesa che il motore termini la sequenza in corso.
+ */
+struct machine_request
+{
+  struct state_machine_struct *machine[MACHINE_CHAIN_SIZE];
+  int machine_count;
+  uintptr_t args[MACHINE_ARGS_SIZE];
+  int arg_count;
+  MachineCallback_t callback;
+  CO_Data *d;
+  int priority; /**< MACHINE_PRIORITY_xxx più alta tra le macchine della richiesta */
+};
 
-volatile int machine_state_index[CANOPEN_NODE_NUMBER];
-int machine_state_param_index[CANOPEN_NODE_NUMBER];
+/**
+ * Richieste in attesa di un motore, ordinate per priorità e, a parità di
+ * priorità, per ordine di arrivo. Protetta da machine_mux.
+ */
+struct machine_queue
+{
+  struct machine_request request[MACHINE_QUEUE_SIZE];
+  int count;
+};
 
-MachineCallback_t callback_user[CANOPEN_NODE_NUMBER];
+static struct machine_queue machine_queue[CANOPEN_NODE_NUMBER];
 
-#ifndef SDO_SYNC
 pthread_mutex_t machine_mux[CANOPEN_NODE_NUMBER];
 volatile int machine_run[CANOPEN_NODE_NUMBER];
-#else
-pthread_mutex_t machine_mux;
-volatile int machine_run = 0;
-pthread_cond_t machine_run_cond = PTHREAD_COND_INITIALIZER;
-#endif
+
+#define MACHINE_SDO_IDLE 0
+#define MACHINE_SDO_WAITING 1 // in coda per una linea SDO
+#define MACHINE_SDO_INFLIGHT 2
+
+/**
+ * Motori in attesa di una linea SDO, in ordine di arrivo. Un motore ha al più
+ * un passo in attesa, per cui basta un posto per nodo.
+ */
+struct machine_sdo_queue
+{
+  UNS8 node[CANOPEN_NODE_NUMBER];
+  int head;
+  int count;
+};
+
+/*
+ * Scheduler delle richieste SDO delle macchine a stati. Ogni motore ha al più
+ * un trasferimento in corso e sul bus ce ne sono al più sdo_inflight_max: gli
+ * altri motori aspettano in coda e ricevono la linea, uno per volta, quando un
+ * trasferimento si conclude. Le code sono servite in ordine di priorità, per
+ * cui la fermata di un motore passa davanti alla configurazione degli altri.
+ *
+ * Le linee SDO di CanFestival sono SDO_MAX_SIMULTANEOUS_TRANSFERS: con più
+ * motori, una richiesta broadcast senza scheduler fallisce per mancanza di
+ * linee libere.
+ */
+static pthread_mutex_t sdo_scheduler_mux = PTHREAD_MUTEX_INITIALIZER;
+static struct machine_sdo_queue sdo_queue[MACHINE_PRIORITY_COUNT];
+static UNS8 sdo_state[CANOPEN_NODE_NUMBER]; /**< MACHINE_SDO_xxx */
+static int sdo_inflight = 0;
+static int sdo_inflight_max = SDO_MAX_SIMULTANEOUS_TRANSFERS;
 
 char error_text[100];
 
-void *smart_start[12] =
-{
-&masterSendNMTstateChange, // Start canopen node
-    &writeNetworkDictCallBack, // Change state: switched off
-    &writeNetworkDictCallBack, // Reset status word
-    &writeNetworkDictCallBack, // Change state: switched off
-    &writeNetworkDictCallBack, // Set mode velocity
-    &writeNetworkDictCallBack, // Set velocity in PV mode
-    &writeNetworkDictCallBack, // Set acceleration
-    &writeNetworkDictCallBack, // Set deceleration
-    &writeNetworkDictCallBack, // Set following error window
-    &writeNetworkDictCallBack, // Change state: ready to switch on
-    &writeNetworkDictCallBack, // Change state: switched on
-    &writeNetworkDictCallBack,
-// Start command
-    };
-UNS32 smart_start_param[56] =
-{
-NMT_Start_Node,  // Start canopen node
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x0,  // Change state: switched off
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x80,  // Reset status word
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x0,  // Change state: switched off
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x3,  // Set mode velocity
-    0x60FF,
-    0x0,
-    4,
-    0,
-    0x0,  // Set velocity in PV mode
-    0x6083,
-    0x0,
-    4,
-    0,
-    0x1000,  // Set acceleration
-    0x6084,
-    0x0,
-    4,
-    0,
-    0xa,  // Set deceleration
-    0x6065,
-    0x0,
-    4,
-    0,
-    2000,  // Set following error window
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6,  // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7,  // Change state: switched on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xF,
-// Start command
-    };
-
-char *smart_start_error[2] =
-{
-"smartmotor started", "Cannot start smartmotor"
+static const struct machine_step smart_start_step[] =
+{
+  { MACHINE_NMT, 0, 0, 0, 0, NMT_Start_Node, 0 }, // Start canopen node
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset status word
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x3, 0 }, // Set mode velocity
+  { MACHINE_SDO_WRITE, 0x60FF, 0x0, 4, 0, 0x0, 0 }, // Set velocity in PV mode
+  { MACHINE_SDO_WRITE, 0x6083, 0x0, 4, 0, 0x1000, 0 }, // Set acceleration
+  { MACHINE_SDO_WRITE, 0x6084, 0x0, 4, 0, 0xa, 0 }, // Set deceleration
+  { MACHINE_SDO_WRITE, 0x6065, 0x0, 4, 0, 2000, 0 }, // Set following error window
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Start command
 };
 
 struct state_machine_struct smart_start_machine =
 {
-smart_start, 12, smart_start_param, 56, smart_start_error
+  smart_start_step, MACHINE_STEP_COUNT(smart_start_step),
+  { "smartmotor started", "Cannot start smartmotor" }
 };
 
-void *map1_pdo[7] =
-{
-&writeNetworkDictCallBack, // Set bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set the number of entry to 0
-    &writeNetworkDictCallBack, // Set the mapping object
-    &writeNetworkDictCallBack, // Set the number of entry
-    &writeNetworkDictCallBack, // Clear bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set transmission type on event timer
-    &writeNetworkDictCallBack
-// Set transmission time
-    };
 /**
  * Optional parameter:
  *      0x1800 | pdo_number
@@ -155,64 +146,24 @@ void *map1_pdo[7] =
  *      transmission type
  *      0x1800 | pdo_number
  *      transmission time
- */UNS32 map1_pdo_param[35] =
-{
-0xFFFFFFFF, 0x1, 4, 0, 0xFFFFFFFF, // Set bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x00, // Set the number of entry to 0
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object: status word
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x01, // Set the number of entry
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Clear bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x2,
-    1,
-    0,
-    0xFFFFFFFF, // Set transmission type on event timer
-    0xFFFFFFFF,
-    0x5,
-    2,
-    0,
-    0xFFFFFFFF
-// Set transmission time on event timer
-    };
-
-char *map1_pdo_error[2] =
-{
-"PDO mapped", "Cannot map PDO"
+ */
+static const struct machine_step map1_pdo_step[] =
+{
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x00, MACHINE_ARG_INDEX }, // Set the number of entry to 0
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object: status word
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x01, MACHINE_ARG_INDEX }, // Set the number of entry
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Clear bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x2, 1, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission type on event timer
+  { MACHINE_SDO_WRITE, 0, 0x5, 2, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission time on event timer
 };
 
 struct state_machine_struct map1_pdo_machine =
 {
-map1_pdo, 7, map1_pdo_param, 35, map1_pdo_error
+  map1_pdo_step, MACHINE_STEP_COUNT(map1_pdo_step),
+  { "PDO mapped", "Cannot map PDO" }
 };
 
-void *map2_pdo[8] =
-{
-&writeNetworkDictCallBack, // Set bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set the number of entry to 0
-    &writeNetworkDictCallBack, // Set the mapping object
-    &writeNetworkDictCallBack, // Set the mapping object
-    &writeNetworkDictCallBack, // Set the number of entry
-    &writeNetworkDictCallBack, // Clear bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set transmission type on event timer
-    &writeNetworkDictCallBack
-// Set transmission time
-    };
 /**
  * Optional parameter:
  *      0x1800 | pdo_number
@@ -229,70 +180,25 @@ void *map2_pdo[8] =
  *      transmission type
  *      0x1800 | pdo_number
  *      transmission time
- */UNS32 map2_pdo_param[40] =
-{
-0xFFFFFFFF, 0x1, 4, 0, 0xFFFFFFFF, // Set bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x00, // Set the number of entry to 0
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object
-    0xFFFFFFFF,
-    0x2,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x02, // Set the number of entry
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Clear bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x2,
-    1,
-    0,
-    0xFFFFFFFF, // Set transmission type on event timer
-    0xFFFFFFFF,
-    0x5,
-    2,
-    0,
-    0xFFFFFFFF
-// Set transmission time on event timer
-    };
-
-char *map2_pdo_error[2] =
-{
-"PDO mapped", "Cannot map PDO"
+ */
+static const struct machine_step map2_pdo_step[] =
+{
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x00, MACHINE_ARG_INDEX }, // Set the number of entry to 0
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object
+  { MACHINE_SDO_WRITE, 0, 0x2, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x02, MACHINE_ARG_INDEX }, // Set the number of entry
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Clear bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x2, 1, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission type on event timer
+  { MACHINE_SDO_WRITE, 0, 0x5, 2, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission time on event timer
 };
 
 struct state_machine_struct map2_pdo_machine =
 {
-map2_pdo, 8, map2_pdo_param, 40, map2_pdo_error
+  map2_pdo_step, MACHINE_STEP_COUNT(map2_pdo_step),
+  { "PDO mapped", "Cannot map PDO" }
 };
 
-void *map3_pdo[9] =
-{
-&writeNetworkDictCallBack, // Set bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set the number of entry to 0
-    &writeNetworkDictCallBack, // Set the mapping object 1
-    &writeNetworkDictCallBack, // Set the mapping object 2
-    &writeNetworkDictCallBack, // Set the mapping object 3
-    &writeNetworkDictCallBack, // Set the number of entry
-    &writeNetworkDictCallBack, // Clear bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set transmission type on event timer
-    &writeNetworkDictCallBack
-// Set transmission time
-    };
 /**
  * Optional parameter:
  *      0x1800 | pdo_number
@@ -311,76 +217,26 @@ void *map3_pdo[9] =
  *      transmission type
  *      0x1800 | pdo_number
  *      transmission time
- */UNS32 map3_pdo_param[45] =
-{
-0xFFFFFFFF, 0x1, 4, 0, 0xFFFFFFFF, // Set bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x00, // Set the number of entry to 0
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 1
-    0xFFFFFFFF,
-    0x2,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 2
-    0xFFFFFFFF,
-    0x3,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 3
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x03, // Set the number of entry
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Clear bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x2,
-    1,
-    0,
-    0xFFFFFFFF, // Set transmission type on event timer
-    0xFFFFFFFF,
-    0x5,
-    2,
-    0,
-    0xFFFFFFFF
-// Set transmission time on event timer
-    };
-
-char *map3_pdo_error[2] =
-{
-"PDO mapped", "Cannot map PDO"
+ */
+static const struct machine_step map3_pdo_step[] =
+{
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x00, MACHINE_ARG_INDEX }, // Set the number of entry to 0
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 1
+  { MACHINE_SDO_WRITE, 0, 0x2, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 2
+  { MACHINE_SDO_WRITE, 0, 0x3, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 3
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x03, MACHINE_ARG_INDEX }, // Set the number of entry
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Clear bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x2, 1, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission type on event timer
+  { MACHINE_SDO_WRITE, 0, 0x5, 2, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission time on event timer
 };
 
 struct state_machine_struct map3_pdo_machine =
 {
-map3_pdo, 9, map3_pdo_param, 45, map3_pdo_error
+  map3_pdo_step, MACHINE_STEP_COUNT(map3_pdo_step),
+  { "PDO mapped", "Cannot map PDO" }
 };
 
-void *map4_pdo[10] =
-{
-&writeNetworkDictCallBack, // Set bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set the number of entry to 0
-    &writeNetworkDictCallBack, // Set the mapping object 1
-    &writeNetworkDictCallBack, // Set the mapping object 2
-    &writeNetworkDictCallBack, // Set the mapping object 3
-    &writeNetworkDictCallBack, // Set the mapping object 4
-    &writeNetworkDictCallBack, // Set the number of entry
-    &writeNetworkDictCallBack, // Clear bit 31 of the COB-ID
-    &writeNetworkDictCallBack, // Set transmission type on event timer
-    &writeNetworkDictCallBack
-// Set transmission time
-    };
 /**
  * Optional parameter:
  *      0x1800 | pdo_number
@@ -401,1201 +257,454 @@ void *map4_pdo[10] =
  *      transmission type
  *      0x1800 | pdo_number
  *      transmission time
- */UNS32 map4_pdo_param[50] =
-{
-0xFFFFFFFF, 0x1, 4, 0, 0xFFFFFFFF, // Set bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x00, // Set the number of entry to 0
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 1
-    0xFFFFFFFF,
-    0x2,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 2
-    0xFFFFFFFF,
-    0x3,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 3
-    0xFFFFFFFF,
-    0x4,
-    4,
-    0,
-    0xFFFFFFFF, // Set the mapping object 4
-    0xFFFFFFFF,
-    0x0,
-    1,
-    0,
-    0x04, // Set the number of entry
-    0xFFFFFFFF,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Clear bit 31 of the COB-ID
-    0xFFFFFFFF,
-    0x2,
-    1,
-    0,
-    0xFFFFFFFF, // Set transmission type on event timer
-    0xFFFFFFFF,
-    0x5,
-    2,
-    0,
-    0xFFFFFFFF
-// Set transmission time on event timer
-    };
-
-char *map4_pdo_error[2] =
-{
-"PDO mapped", "Cannot map PDO"
+ */
+static const struct machine_step map4_pdo_step[] =
+{
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x00, MACHINE_ARG_INDEX }, // Set the number of entry to 0
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 1
+  { MACHINE_SDO_WRITE, 0, 0x2, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 2
+  { MACHINE_SDO_WRITE, 0, 0x3, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 3
+  { MACHINE_SDO_WRITE, 0, 0x4, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set the mapping object 4
+  { MACHINE_SDO_WRITE, 0, 0x0, 1, 0, 0x04, MACHINE_ARG_INDEX }, // Set the number of entry
+  { MACHINE_SDO_WRITE, 0, 0x1, 4, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Clear bit 31 of the COB-ID
+  { MACHINE_SDO_WRITE, 0, 0x2, 1, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission type on event timer
+  { MACHINE_SDO_WRITE, 0, 0x5, 2, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_VALUE }, // Set transmission time on event timer
 };
 
 struct state_machine_struct map4_pdo_machine =
 {
-map4_pdo, 10, map4_pdo_param, 50, map4_pdo_error
+  map4_pdo_step, MACHINE_STEP_COUNT(map4_pdo_step),
+  { "PDO mapped", "Cannot map PDO" }
 };
 
-void *heart_start[1] =
-{
-&writeNetworkDictCallBack
-};
-UNS32 heart_start_param[5] =
+static const struct machine_step heart_start_step[] =
 {
-0x1017, 0x0, 2, 0, 0xFFFFFFFF
+  { MACHINE_SDO_WRITE, 0x1017, 0x0, 2, 0, 0, MACHINE_ARG_VALUE },
 };
 
-char *heart_start_error[2] =
+struct state_machine_struct heart_start_machine =
 {
-"Heartbeat configured", "Cannot configure heartbeat"
+  heart_start_step, MACHINE_STEP_COUNT(heart_start_step),
+  { "Heartbeat configured", "Cannot configure heartbeat" }
 };
 
-struct state_machine_struct heart_start_machine =
+static const struct machine_step smart_stop_step[] =
 {
-heart_start, 1, heart_start_param, 5, heart_start_error
-};
-
-void *smart_stop[10] =
-{
-&writeNetworkDictCallBack,  // Change state: switched off
-    &writeNetworkDictCallBack,  // Change state: switched off
-    &writeNetworkDictCallBack,  // Change state: switched off
-    &writeNetworkDictCallBack,  // Disable positive limit switch input
-    &writeNetworkDictCallBack,  // Disable negative limit switch input
-    &writeNetworkDictCallBack,  // Set mode velocity
-    &writeNetworkDictCallBack,  // Set velocity in PV mode
-    &writeNetworkDictCallBack,  // Change state: ready to switch on
-    &writeNetworkDictCallBack,  // Change state: switched on
-    &writeNetworkDictCallBack,
-// Start command
-    };
-UNS32 smart_stop_param[50] =
-{
-0x6040, 0x0, 2, 0, 0x0,  // Change state: switched off
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x80,  // Change state: switched off
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x0,  // Change state: switched off
-    0x2101,
-    0x3,
-    2,
-    0,
-    0x2,  // Disable positive limit switch input
-    0x2101,
-    0x3,
-    2,
-    0,
-    0x3,  // Disable negative limit switch input
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x3,  // Set mode velocity
-    0x60FF,
-    0x0,
-    4,
-    0,
-    0x0,  // Set velocity in PV mode
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6,  // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7,  // Change state: switched on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xF,
-// Start command
-    };
-
-char *smart_stop_error[2] =
-{
-"smart motor stopped", "cannost stop smartmotor"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x2101, 0x3, 2, 0, 0x2, 0 }, // Disable positive limit switch input
+  { MACHINE_SDO_WRITE, 0x2101, 0x3, 2, 0, 0x3, 0 }, // Disable negative limit switch input
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x3, 0 }, // Set mode velocity
+  { MACHINE_SDO_WRITE, 0x60FF, 0x0, 4, 0, 0x0, 0 }, // Set velocity in PV mode
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Start command
 };
 
 struct state_machine_struct smart_stop_machine =
 {
-smart_stop, 10, smart_stop_param, 50, smart_stop_error
+  smart_stop_step, MACHINE_STEP_COUNT(smart_stop_step),
+  { "smart motor stopped", "cannost stop smartmotor" }, MACHINE_PRIORITY_SAFETY
 };
 
-void *smart_position_set_function[9] =
-{
-&writeNetworkDictCallBack, // Reset the status word
-    &writeNetworkDictCallBack, // Set mode position
-    &writeNetworkDictCallBack, // Set profile speed
-    &writeNetworkDictCallBack, // Set target position to zero
-    &writeNetworkDictCallBack, // Set acceleration
-    &writeNetworkDictCallBack, // Set deceleration
-    &writeNetworkDictCallBack, // Change state: ready to switch on
-    &writeNetworkDictCallBack, // Change state: switched on
-    &writeNetworkDictCallBack,
-// Enable command, single setpoint (motion not actually started yet)
-    };
-
 /*
  * param
  * profile speed
  * target point
  * procile acceleration
- */UNS32 smart_position_set_param[45] =
-{
-0x6040, 0x0, 2, 0, 0x80, // Reset status word
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x1, // Set mode position
-    0x6083,
-    0x0,
-    4,
-    0,
-    0xFFFFFFFF, // Set acceleration
-    0x6084,
-    0x0,
-    4,
-    0,
-    0xFFFFFFFF, // Set deceleration
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7, // Change state: switched on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x2F, // Enable command, single setpoint (motion not actually started yet)
-    0x6081,
-    0x0,
-    4,
-    0,
-    0xFFFFFFFF, // Set profile speed
-    0x607A,
-    0x0,
-    4,
-    0,
-    0xFFFFFFFF, // Set target position to destination
-
-    };
-
-char *smart_position_set_error[2] =
-{
-"set target point", "cannot set target point"
+ */
+static const struct machine_step smart_position_set_step[] =
+{
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset status word
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x1, 0 }, // Set mode position
+  { MACHINE_SDO_WRITE, 0x6083, 0x0, 4, 0, 0, MACHINE_ARG_VALUE }, // Set acceleration
+  { MACHINE_SDO_WRITE, 0x6084, 0x0, 4, 0, 0, MACHINE_ARG_VALUE }, // Set deceleration
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x2F, 0 }, // Enable command, single setpoint (motion not actually started yet)
+  { MACHINE_SDO_WRITE, 0x6081, 0x0, 4, 0, 0, MACHINE_ARG_VALUE }, // Set profile speed
+  { MACHINE_SDO_WRITE, 0x607A, 0x0, 4, 0, 0, MACHINE_ARG_VALUE }, // Set target position to destination
 };
 
 struct state_machine_struct smart_position_set_machine =
 {
-smart_position_set_function, 9, smart_position_set_param, 45, smart_position_set_error
+  smart_position_set_step, MACHINE_STEP_COUNT(smart_position_set_step),
+  { "set target point", "cannot set target point" }
 };
 
-void *smart_position_start_function[1] =
-{
-&writeNetworkDictCallBack
-// Begin motion to target position
-    };
-
-UNS32 smart_position_start_param[5] =
+static const struct machine_step smart_position_start_step[] =
 {
-0x6040, 0x0, 2, 0, 0x3F
-// Begin motion to target position
-    };
-
-char *smart_position_start_error[2] =
-{
-"smart motor go to target point. . .", "cannot begin motion"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x3F, 0 }, // Begin motion to target position
 };
 
 struct state_machine_struct smart_position_start_machine =
 {
-smart_position_start_function, 1, smart_position_start_param, 5, smart_position_start_error
-};
-
-void *smart_set_mode_function[4] =
-{
-    &writeNetworkDictCallBack,
-    &writeNetworkDictCallBack,
-    &writeNetworkDictCallBack,
-    &writeNetworkDictCallBack
+  smart_position_start_step, MACHINE_STEP_COUNT(smart_position_start_step),
+  { "smart motor go to target point. . .", "cannot begin motion" }
 };
 
-UNS32 smart_set_mode_param[25] =
-{
-0x6040, 0x0, 2, 0, 0x80, // Reset status word
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x1, // Set mode position
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7, // Change state: switched on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x2F
-// Enable command, single setpoint (motion not actually started yet)
-    };
-
-char *smart_set_mode_error[2] =
+static const struct machine_step smart_set_mode_step[] =
 {
-"smart motor go to target point. . .", "cannot set mode"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset status word
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x1, 0 }, // Set mode position
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  //{ MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x2F, 0 }, // Enable command, single setpoint
 };
 
 struct state_machine_struct smart_set_mode_machine =
 {
-smart_set_mode_function, 4, smart_set_mode_param, 25, smart_set_mode_error
-};
-
-void *smart_message_function[1] =
-{
-&writeNetworkDictCallBack
-};
-
-UNS32 smart_message_param[5] =
-{
-0x2500, 0x01, 0xFFFFFFFF, visible_string, 0xFFFFFFFF
+  smart_set_mode_step, MACHINE_STEP_COUNT(smart_set_mode_step),
+  { "smart motor go to target point. . .", "cannot set mode" }
 };
 
-char *smart_message_error[2] =
+static const struct machine_step smart_message_step[] =
 {
-"smartmotor message sent. . .", "cannot sent smart message"
+  // il motore esegue il comando alla ricezione: ripeterlo dopo un timeout
+  // potrebbe eseguirlo due volte
+  { MACHINE_SDO_WRITE, 0x2500, 0x01, 0, visible_string, 0, MACHINE_ARG_SIZE | MACHINE_ARG_STRING, 0, 1 },
 };
 
 struct state_machine_struct smart_message_machine =
 {
-smart_message_function, 1, smart_message_param, 5, smart_message_error
-};
-
-void *smart_interpolation_test1[19] =
-{
-&writeNetworkDictCallBack, // Reset the status word
-    &writeNetworkDictCallBack, // Set interpolation mode
-    &writeNetworkDictCallBack, // Change state: ready to switch on
-    &writeNetworkDictCallBack, // Change state: switched on
-    &writeNetworkDictCallBack, // Clear buffer
-    &writeNetworkDictCallBack, // Enable buffer
-    &writeNetworkDictCallBack, // Set time period to 1 (second)
-    &writeNetworkDictCallBack, // Set time period to seconds
-    &writeNetworkDictCallBack, // Write data point 1
-    &writeNetworkDictCallBack, // Write data point 2
-    &writeNetworkDictCallBack, // Write data point 3
-    &writeNetworkDictCallBack, // Write data point 4
-    &writeNetworkDictCallBack, // Write data point 5
-    &writeNetworkDictCallBack, // Write data point 6
-    &writeNetworkDictCallBack, // Write zero-length segment
-    &writeNetworkDictCallBack, // Write data point
-    &writeNetworkDictCallBack, // This is required to satisfy CiA 402 drive state machine
-    &writeNetworkDictCallBack, // Enable command (motion not actually started yet
-    &writeNetworkDictCallBack
-// Begin motion
-    };
-UNS32 smart_interpolation_test1_param[95] =
-{
-0x6040, 0x0, 2, 0, 0x80, // Reset the status word
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x7, // Set interpolation mode
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7, // Change state: switched on
-    0x60C4,
-    0x6,
-    1,
-    0,
-    0x0, // Clear buffer
-    0x60C4,
-    0x6,
-    1,
-    0,
-    0x1, // Enable buffer
-    0x60C2,
-    0x1,
-    1,
-    0,
-    0x1, // Set time period to 1 (second)
-    0x60C2,
-    0x2,
-    1,
-    0,
-    0x0, // Set time period to seconds
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x0, // Write data point 1
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x3E8, // Write data point 2
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0xBB8, // Write data point 3
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x7D0, // Write data point 4
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x3E8, // Write data point 5
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x0, // Write data point 6
-    0x60C2,
-    0x1,
-    1,
-    0,
-    0x0, // Write zero-length segment
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x0, // Write data point
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // This is required to satisfy CiA 402 drive state machine
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xF, // Enable command (motion not actually started yet
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x1F
-// Begin motion
-    };
-
-char *smart_interpolation_test1_error[2] =
-{
-"smartmotor interpolation mode started", "Cannot start smartmotor in interpolation mode"
+  smart_message_step, MACHINE_STEP_COUNT(smart_message_step),
+  { "smartmotor message sent. . .", "cannot sent smart message" }
+};
+
+static const struct machine_step smart_interpolation_test1_step[] =
+{
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset the status word
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x7, 0 }, // Set interpolation mode
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  { MACHINE_SDO_WRITE, 0x60C4, 0x6, 1, 0, 0x0, 0 }, // Clear buffer
+  { MACHINE_SDO_WRITE, 0x60C4, 0x6, 1, 0, 0x1, 0 }, // Enable buffer
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x1, 0 }, // Set time period to 1 (second)
+  { MACHINE_SDO_WRITE, 0x60C2, 0x2, 1, 0, 0x0, 0 }, // Set time period to seconds
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x0, 0 }, // Write data point 1
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x3E8, 0 }, // Write data point 2
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0xBB8, 0 }, // Write data point 3
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x7D0, 0 }, // Write data point 4
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x3E8, 0 }, // Write data point 5
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x0, 0 }, // Write data point 6
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x0, 0 }, // Write zero-length segment
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x0, 0 }, // Write data point
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // This is required to satisfy CiA 402 drive state machine
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Enable command (motion not actually started yet
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x1F, 0 }, // Begin motion
 };
 
 struct state_machine_struct smart_interpolation_test1_machine =
 {
-smart_interpolation_test1, 19, smart_interpolation_test1_param, 95, smart_interpolation_test1_error
-};
-
-void *smart_interpolation_test2[19] =
-{
-&writeNetworkDictCallBack, // Reset the status word
-    &writeNetworkDictCallBack, // Change state: ready to switch on
-    &writeNetworkDictCallBack, // Change state: switched on
-    &writeNetworkDictCallBack, // Clear buffer
-    &writeNetworkDictCallBack, // Enable buffer
-    &writeNetworkDictCallBack, // Set time period to seconds
-    &writeNetworkDictCallBack, // Set time period to 1 (second)
-    &writeNetworkDictCallBack, // Set interpolation mode
-    &writeNetworkDictCallBack, // Write data point 1
-    &writeNetworkDictCallBack, // Write data point 2
-    &writeNetworkDictCallBack, // Write data point 3
-    &writeNetworkDictCallBack, // Write data point 4
-    &writeNetworkDictCallBack, // Write data point 5
-    &writeNetworkDictCallBack, // Write data point 6
-    &writeNetworkDictCallBack, // Write zero-length segment
-    &writeNetworkDictCallBack, // Write data point
-    &writeNetworkDictCallBack, // This is required to satisfy CiA 402 drive state machine
-    &writeNetworkDictCallBack, // Enable command (motion not actually started yet
-    &writeNetworkDictCallBack
-// Begin motion
-    };
-UNS32 smart_interpolation_test2_param[95] =
-{
-0x6040, 0x0, 2, 0, 0x80, // Reset the status word
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7, // Change state: switched on
-    0x60C4,
-    0x6,
-    1,
-    0,
-    0x0, // Clear buffer
-    0x60C4,
-    0x6,
-    1,
-    0,
-    0x1, // Enable buffer
-    0x60C2,
-    0x2,
-    1,
-    0,
-    0xFD, // Set time period to seconds
-    0x60C2,
-    0x1,
-    1,
-    0,
-    0x14, // Set time period to 1 (second)
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x7, // Set interpolation mode
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x0, // Write data point 1
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x3E8, // Write data point 2
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0xBB8, // Write data point 3
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x7D0, // Write data point 4
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x3E8, // Write data point 5
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x0, // Write data point 6
-    0x60C2,
-    0x1,
-    1,
-    0,
-    0x0, // Write zero-length segment
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0x0, // Write data point
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // This is required to satisfy CiA 402 drive state machine
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xF, // Enable command (motion not actually started yet
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x1F
-// Begin motion
-    };
-
-char *smart_interpolation_test2_error[2] =
-{
-"smartmotor interpolation mode started", "Cannot start smartmotor in interpolation mode"
+  smart_interpolation_test1_step, MACHINE_STEP_COUNT(smart_interpolation_test1_step),
+  { "smartmotor interpolation mode started", "Cannot start smartmotor in interpolation mode" }
+};
+
+static const struct machine_step smart_interpolation_test2_step[] =
+{
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset the status word
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  { MACHINE_SDO_WRITE, 0x60C4, 0x6, 1, 0, 0x0, 0 }, // Clear buffer
+  { MACHINE_SDO_WRITE, 0x60C4, 0x6, 1, 0, 0x1, 0 }, // Enable buffer
+  { MACHINE_SDO_WRITE, 0x60C2, 0x2, 1, 0, 0xFD, 0 }, // Set time period to seconds
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x14, 0 }, // Set time period to 1 (second)
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x7, 0 }, // Set interpolation mode
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x0, 0 }, // Write data point 1
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x3E8, 0 }, // Write data point 2
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0xBB8, 0 }, // Write data point 3
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x7D0, 0 }, // Write data point 4
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x3E8, 0 }, // Write data point 5
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x0, 0 }, // Write data point 6
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x0, 0 }, // Write zero-length segment
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0x0, 0 }, // Write data point
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // This is required to satisfy CiA 402 drive state machine
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Enable command (motion not actually started yet
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x1F, 0 }, // Begin motion
 };
 
 struct state_machine_struct smart_interpolation_test2_machine =
 {
-smart_interpolation_test2, 19, smart_interpolation_test2_param, 95, smart_interpolation_test2_error
-};
-
-void *init_interpolation_function[10] =
-{
-&writeNetworkDictCallBack, // Change state: ready to switch on
-    &writeNetworkDictCallBack, // Change state: switched on
-    //&writeNetworkDictCallBack, // Enable positive limit switch
-    //&writeNetworkDictCallBack, // Enable negative limit switch
-    &writeNetworkDictCallBack, // Enable command (motion not actually started yet)
-    &writeNetworkDictCallBack, // Clear buffer
-    &writeNetworkDictCallBack, // Enable buffer
-    &writeNetworkDictCallBack, // Set time period to seconds
-    &writeNetworkDictCallBack, // Set time period to 1 (second)
-    &writeNetworkDictCallBack, // Set interpolation mode
-    &writeNetworkDictCallBack, // Set interpolation sub-mode (spline)
-    &writeNetworkDictCallBack
-// Set first point to zero
-    };
+  smart_interpolation_test2_step, MACHINE_STEP_COUNT(smart_interpolation_test2_step),
+  { "smartmotor interpolation mode started", "Cannot start smartmotor in interpolation mode" }
+};
+
 /*
  * Param
  *   current_position
- */UNS32 init_interpolation_param[50] =
-{
-0x6040, 0x0, 2, 0, 0x6, // Change state: ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7, // Change state: switched on
-    //0x2309, 0x0, 2, 0, -4, // Enable positive limit switch
-    //0x2309, 0x0, 2, 0, -5, // Enable negative limit switch
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xF, // Enable command (motion not actually started yet)
-    0x60C4,
-    0x6,
-    1,
-    0,
-    0x0, // Clear buffer
-    0x60C4,
-    0x6,
-    1,
-    0,
-    0x1, // Enable buffer
-    0x60C2,
-    0x1,
-    1,
-    0,
-    0x1, // Set time period to 1 (second)
-    0x60C2,
-    0x2,
-    1,
-    0,
-    0x00, // Set time period to seconds
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x7, // Set interpolation mode
-    0X60C0,
-    0X0,
-    2,
-    0,
-    0, // Set interpolation sub-mode
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF
-// Set first point to current position
-    };
-
-char *init_interpolation_error[2] =
-{
-"smartmotor interpolation mode init", "Cannot init smartmotor in interpolation mode"
+ */
+static const struct machine_step init_interpolation_step[] =
+{
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state: ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // Change state: switched on
+  //{ MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, -4, 0 }, // Enable positive limit switch
+  //{ MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, -5, 0 }, // Enable negative limit switch
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Enable command (motion not actually started yet)
+  { MACHINE_SDO_WRITE, 0x60C4, 0x6, 1, 0, 0x0, 0 }, // Clear buffer
+  { MACHINE_SDO_WRITE, 0x60C4, 0x6, 1, 0, 0x1, 0 }, // Enable buffer
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x1, 0 }, // Set time period to 1 (second)
+  { MACHINE_SDO_WRITE, 0x60C2, 0x2, 1, 0, 0x00, 0 }, // Set time period to seconds
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x7, 0 }, // Set interpolation mode
+  { MACHINE_SDO_WRITE, 0X60C0, 0X0, 2, 0, 0, 0 }, // Set interpolation sub-mode
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0, MACHINE_ARG_VALUE }, // Set first point to current position
 };
 
 struct state_machine_struct init_interpolation_machine =
 {
-init_interpolation_function, 10, init_interpolation_param, 50, init_interpolation_error
+  init_interpolation_step, MACHINE_STEP_COUNT(init_interpolation_step),
+  { "smartmotor interpolation mode init", "Cannot init smartmotor in interpolation mode" }
 };
 
-void *start_interpolation_function[1] =
+static const struct machine_step start_interpolation_step[] =
 {
-&writeNetworkDictCallBack
-// Begin motion
-    };
-UNS32 start_interpolation_param[5] =
-{
-0x6040, 0x0, 2, 0, 0x1F
-// Begin motion
-    };
-
-char *start_interpolation_error[2] =
-{
-"smartmotor interpolation mode start", "Cannot start smartmotor in interpolation mode"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x1F, 0 }, // Begin motion
 };
 
 struct state_machine_struct start_interpolation_machine =
 {
-start_interpolation_function, 1, start_interpolation_param, 5, start_interpolation_error
+  start_interpolation_step, MACHINE_STEP_COUNT(start_interpolation_step),
+  { "smartmotor interpolation mode start", "Cannot start smartmotor in interpolation mode" }
 };
 
-void *gosub_function[1] =
-{
-&writeNetworkDictCallBack
-// Call subroutine
-    };
-
-UNS32 gosub_param[5] =
-{
-0x2309, 0x0, 2, 0, 0xFFFFFFFF
-// Call subroutine
-    };
-
-char *gosub_error[2] =
+static const struct machine_step gosub_step[] =
 {
-"smartmotor subroutine called", "Cannot call smartmotor subroutine"
+  { MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, 0, MACHINE_ARG_VALUE, 0, 1 }, // Call subroutine, una volta sola
 };
 
 struct state_machine_struct gosub_machine =
 {
-gosub_function, 1, gosub_param, 5, gosub_error
+  gosub_step, MACHINE_STEP_COUNT(gosub_step),
+  { "smartmotor subroutine called", "Cannot call smartmotor subroutine" }
 };
 
-void *stop_interpolation_function[2] =
-{
-&writeNetworkDictCallBack, // Write zero-length segment
-    &writeNetworkDictCallBack,// Repeat final data
-    //&writeNetworkDictCallBack // leave drive on but holding at the ending position
-    };
-UNS32 stop_interpolation_param[10] =
-{
-    0x60C2, 0x1, 1, 0, 0x0, // Write zero-length segment
-    0x60C1, 0x1, 4, 0, 0xFFFFFFFF,// Repeat final data
-    //0x6040, 0x0, 2, 0, 0x0F, // leave drive on but holding at the ending position
-    };
-
-char *stop_interpolation_error[2] =
+static const struct machine_step stop_interpolation_step[] =
 {
-"smartmotor interpolation mode closing. . .", "Cannot stop simulation"
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x0, 0 }, // Write zero-length segment
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0, MACHINE_ARG_VALUE }, // Repeat final data
+  //{ MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0F, 0 }, // leave drive on but holding at the ending position
 };
 
 struct state_machine_struct stop_interpolation_machine =
 {
-stop_interpolation_function, 2, stop_interpolation_param, 10, stop_interpolation_error
+  stop_interpolation_step, MACHINE_STEP_COUNT(stop_interpolation_step),
+  { "smartmotor interpolation mode closing. . .", "Cannot stop simulation" }
 };
 
-void *resume_interpolation_function[3] =
-{
-&writeNetworkDictCallBack, // Enable command (motion not actually started yet)
-    &writeNetworkDictCallBack, // back to the desire value
-    &writeNetworkDictCallBack
-// Repeat final data
-    };
 /*
  * param:
  *   - current position
- */UNS32 resume_interpolation_param[15] =
-{
-0x6040, 0x0, 2, 0, 0xF, // Enable command (motion not actually started yet)
-    0x60C2,
-    0x1,
-    1,
-    0,
-    0x64, // back to the desire value
-    0x60C1,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF,
-// Repeat final data
-    };
-
-char *resume_interpolation_error[2] =
+ */
+static const struct machine_step resume_interpolation_step[] =
 {
-"Interpolation resumed", "Cannot resume interpolation"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Enable command (motion not actually started yet)
+  { MACHINE_SDO_WRITE, 0x60C2, 0x1, 1, 0, 0x64, 0 }, // back to the desire value
+  { MACHINE_SDO_WRITE, 0x60C1, 0x1, 4, 0, 0, MACHINE_ARG_VALUE }, // Repeat final data
 };
 
 struct state_machine_struct resume_interpolation_machine =
 {
-resume_interpolation_function, 3, resume_interpolation_param, 15, resume_interpolation_error
+  resume_interpolation_step, MACHINE_STEP_COUNT(resume_interpolation_step),
+  { "Interpolation resumed", "Cannot resume interpolation" }
 };
 
-void *smart_off_function[3] =
-{
-&writeNetworkDictCallBack, // Change state: switched off
-    &writeNetworkDictCallBack, // Change state: switched off
-    &writeNetworkDictCallBack,
-// Change state: switched off
-    };
-UNS32 smart_off_param[15] =
-{
-0x6040, 0x0, 2, 0, 0x0,  // Change state: switched off
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x80,  // Change state: switched off
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x0,
-// Change state: switched off
-    };
-
-char *smart_off_error[2] =
+static const struct machine_step smart_off_step[] =
 {
-"smartmotor off", "Cannot switch off smartmotor"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Change state: switched off
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Change state: switched off
 };
 
 struct state_machine_struct smart_off_machine =
 {
-smart_off_function, 3, smart_off_param, 15, smart_off_error
+  smart_off_step, MACHINE_STEP_COUNT(smart_off_step),
+  { "smartmotor off", "Cannot switch off smartmotor" }, MACHINE_PRIORITY_SAFETY
 };
 
-void *torque_function[9] =
-{
-&writeNetworkDictCallBack, // Set mode torque
-    &writeNetworkDictCallBack, // Set torque slope to 200
-    &writeNetworkDictCallBack, // Set torque to zero
-    &writeNetworkDictCallBack, // Change state ready to switch on
-    &writeNetworkDictCallBack
-// Start command
-    };
 /*
  * Param
  *   torque
- */UNS32 torque_param[25] =
-{
-0x6060, 0x0, 1, 0, 0x4, // Set mode torque
-    0x6087,
-    0x0,
-    4,
-    0,
-    0xC8, // Set torque slope to 200
-    0x6071,
-    0x0,
-    2,
-    0,
-    0xFFFFFFFF, // Set torque
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // Change state ready to switch on
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xf
-// Start command
-    };
-
-char *torque_error[2] =
-{
-"smartmotor torque mode", "Cannot pass smartmotor in torque mode"
+ */
+static const struct machine_step torque_step[] =
+{
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x4, 0 }, // Set mode torque
+  { MACHINE_SDO_WRITE, 0x6087, 0x0, 4, 0, 0xC8, 0 }, // Set torque slope to 200
+  { MACHINE_SDO_WRITE, 0x6071, 0x0, 2, 0, 0, MACHINE_ARG_VALUE }, // Set torque
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // Change state ready to switch on
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xf, 0 }, // Start command
 };
 
 struct state_machine_struct torque_machine =
 {
-torque_function, 5, torque_param, 25, torque_error
+  torque_step, MACHINE_STEP_COUNT(torque_step),
+  { "smartmotor torque mode", "Cannot pass smartmotor in torque mode" }
 };
 
-void *smart_limit_disable_function[2] =
+static const struct machine_step smart_limit_disable_step[] =
 {
-&writeNetworkDictCallBack, // Enable left limit switch
-    &writeNetworkDictCallBack
-// Enable right limit switch
-    };
-UNS32 smart_limit_disable_param[10] =
-{
-0x2101, 0x3, 2, 0, 0x2,  // Disable positive limit switch input
-    0x2101,
-    0x3,
-    2,
-    0,
-    0x3,
-// Disable negative limit switch input
-
-    };
-
-char *smart_limit_disable_error[2] =
-{
-"smartmotor disable limits", "Cannot disable limits"
+  { MACHINE_SDO_WRITE, 0x2101, 0x3, 2, 0, 0x2, 0 }, // Disable positive limit switch input
+  { MACHINE_SDO_WRITE, 0x2101, 0x3, 2, 0, 0x3, 0 }, // Disable negative limit switch input
 };
 
 struct state_machine_struct smart_limit_disable_machine =
 {
-smart_limit_disable_function, 2, smart_limit_disable_param, 10, smart_limit_disable_error
+  smart_limit_disable_step, MACHINE_STEP_COUNT(smart_limit_disable_step),
+  { "smartmotor disable limits", "Cannot disable limits" }
 };
 
-void *smart_limit_enable_function[2] =
-{
-&writeNetworkDictCallBack, // Enable left limit switch
-    &writeNetworkDictCallBack
-// Enable right limit switch
-    };
 /*
  * param:
  *   forward velocity
  *   backward velocity
  *   homing offset
- */UNS32 smart_limit_enable_param[10] =
-{
-0x2309, 0x0, 2, 0, -4, // Enable positive limit switch
-    0x2309,
-    0x0,
-    2,
-    0,
-    -5
-// Enable negative limit switch
-    };
-
-char *smart_limit_enable_error[2] =
+ */
+static const struct machine_step smart_limit_enable_step[] =
 {
-"smartmotor enable limits", "Cannot enable limits"
+  { MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, -4, 0 }, // Enable positive limit switch
+  { MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, -5, 0 }, // Enable negative limit switch
 };
 
 struct state_machine_struct smart_limit_enable_machine =
 {
-smart_limit_enable_function, 2, smart_limit_enable_param, 10, smart_limit_enable_error
-};
-
-void *smart_homing_function[15] =
-{
-&writeNetworkDictCallBack, // Reset status word
-    &writeNetworkDictCallBack, // Reset status word
-    &writeNetworkDictCallBack, // Reset status word
-    &writeNetworkDictCallBack, // Enable left limit switch
-    &writeNetworkDictCallBack, // Enable right limit switch
-    &writeNetworkDictCallBack, // Set mode of operation to homing
-    &writeNetworkDictCallBack, // Set homing method
-    &writeNetworkDictCallBack, // Set homing speed during search for switch
-    &writeNetworkDictCallBack, // Set homing speed during search for zero
-    &writeNetworkDictCallBack, // Set homing acceleration
-    &writeNetworkDictCallBack, // Set homing offset
-    &writeNetworkDictCallBack, // This is required to satisfy cia 402 drive state machine
-    &writeNetworkDictCallBack, // This is required to satisfy cia 402 drive state machine
-    &writeNetworkDictCallBack, // Enable command (motion not actually started yet)
-    &writeNetworkDictCallBack,
-// Begin motion
-    };
+  smart_limit_enable_step, MACHINE_STEP_COUNT(smart_limit_enable_step),
+  { "smartmotor enable limits", "Cannot enable limits" }
+};
+
 /*
  * param:
  *   forward velocity
  *   backward velocity
  *   homing offset
- */UNS32 smart_homing_param[75] =
-{
-0x6040, 0x0, 2, 0, 0x0, // Reset status word
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x80, // Reset status word
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x0, // Reset status word
-    0x6060,
-    0x0,
-    1,
-    0,
-    0x6, // Set mode of operation to homing
-    0x6098,
-    0x0,
-    1,
-    0,
-    18, // Set homing method
-    0x2309,
-    0x0,
-    2,
-    0,
-    -4, // Enable positive limit switch
-    0x2309,
-    0x0,
-    2,
-    0,
-    -5, // Enable negative limit switch
-    0x6099,
-    0x1,
-    4,
-    0,
-    0xFFFFFFFF, // Set homing speed during search for switch
-    0x6099,
-    0x2,
-    4,
-    0,
-    0xFFFFFFFF, // Set homing speed during search for zero
-    0x609a,
-    0x0,
-    4,
-    0,
-    10, // Set homing acceleration
-    0x607c,
-    0x0,
-    4,
-    0,
-    0xFFFFFFFF, // Set homing offset
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x6, // This is required to satisfy cia 402 drive state machine
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x7, // This is required to satisfy cia 402 drive state machine
-    0x6040,
-    0x0,
-    2,
-    0,
-    0xF, // Enable command (motion not actually started yet)
-    0x6040,
-    0x0,
-    2,
-    0,
-    0x1F,
-// Begin motion
-
-    };
-
-char *smart_homing_error[2] =
-{
-"smartmotor homing. . .", "Cannot run smart motor in homing mode"
+ */
+static const struct machine_step smart_homing_step[] =
+{
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Reset status word
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset status word
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x0, 0 }, // Reset status word
+  { MACHINE_SDO_WRITE, 0x6060, 0x0, 1, 0, 0x6, 0 }, // Set mode of operation to homing
+  { MACHINE_SDO_WRITE, 0x6098, 0x0, 1, 0, 18, 0 }, // Set homing method
+  { MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, -4, 0 }, // Enable positive limit switch
+  { MACHINE_SDO_WRITE, 0x2309, 0x0, 2, 0, -5, 0 }, // Enable negative limit switch
+  { MACHINE_SDO_WRITE, 0x6099, 0x1, 4, 0, 0, MACHINE_ARG_VALUE }, // Set homing speed during search for switch
+  { MACHINE_SDO_WRITE, 0x6099, 0x2, 4, 0, 0, MACHINE_ARG_VALUE }, // Set homing speed during search for zero
+  { MACHINE_SDO_WRITE, 0x609a, 0x0, 4, 0, 10, 0 }, // Set homing acceleration
+  { MACHINE_SDO_WRITE, 0x607c, 0x0, 4, 0, 0, MACHINE_ARG_VALUE }, // Set homing offset
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x6, 0 }, // This is required to satisfy cia 402 drive state machine
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x7, 0 }, // This is required to satisfy cia 402 drive state machine
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0xF, 0 }, // Enable command (motion not actually started yet)
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x1F, 0 }, // Begin motion
 };
 
 struct state_machine_struct smart_homing_machine =
 {
-smart_homing_function, 15, smart_homing_param, 75, smart_homing_error
+  smart_homing_step, MACHINE_STEP_COUNT(smart_homing_step),
+  { "smartmotor homing. . .", "Cannot run smart motor in homing mode" }
 };
 
-void *smart_acceleration_pp_get_function[1] =
-{
-&readNetworkDictCallback
-// Read smartmotor ADT
-    };
-UNS32 smart_acceleration_pp_get_param[3] =
-{
-0x6083, 0x0, 0
-// Read smartmotor ADT
-    };
-
-char *smart_acceleration_pp_get_error[2] =
+static const struct machine_step smart_acceleration_pp_get_step[] =
 {
-NULL, "Cannot read ADT"
+  { MACHINE_SDO_READ, 0x6083, 0x0, 0, 0, 0, 0 }, // Read smartmotor ADT
 };
 
 struct state_machine_struct smart_acceleration_pp_get_machine =
 {
-    smart_acceleration_pp_get_function,
-    1,
-    smart_acceleration_pp_get_param,
-    3,
-    smart_acceleration_pp_get_error
+  smart_acceleration_pp_get_step, MACHINE_STEP_COUNT(smart_acceleration_pp_get_step),
+  { NULL, "Cannot read ADT" }
 };
 
-void *smart_following_error_get_function[1] =
-{
-&readNetworkDictCallback
-// Read smartmotor EL
-    };
-UNS32 smart_following_error_get_param[3] =
-{
-0x6065, 0x0, 0
-// Read smartmotor EL
-    };
-
-char *smart_following_error_get_error[2] =
+static const struct machine_step smart_following_error_get_step[] =
 {
-NULL, "Cannot read EL"
+  { MACHINE_SDO_READ, 0x6065, 0x0, 0, 0, 0, 0 }, // Read smartmotor EL
 };
 
 struct state_machine_struct smart_following_error_get_machine =
 {
-    smart_following_error_get_function,
-    1,
-    smart_following_error_get_param,
-    3,
-    smart_following_error_get_error
+  smart_following_error_get_step, MACHINE_STEP_COUNT(smart_following_error_get_step),
+  { NULL, "Cannot read EL" }
 };
 
-void *smart_velocity_pp_get_function[1] =
-{
-&readNetworkDictCallback
-// Read smartmotor VT
-    };
-UNS32 smart_velocity_pp_get_param[3] =
-{
-0x6081, 0x0, 0
-// Read smartmotor VT
-    };
-
-char *smart_velocity_pp_get_error[2] =
+static const struct machine_step smart_velocity_pp_get_step[] =
 {
-NULL, "Cannot read VT"
+  { MACHINE_SDO_READ, 0x6081, 0x0, 0, 0, 0, 0 }, // Read smartmotor VT
 };
 
 struct state_machine_struct smart_velocity_pp_get_machine =
 {
-smart_velocity_pp_get_function, 1, smart_velocity_pp_get_param, 3, smart_velocity_pp_get_error
+  smart_velocity_pp_get_step, MACHINE_STEP_COUNT(smart_velocity_pp_get_step),
+  { NULL, "Cannot read VT" }
 };
 
-void *smart_velocity_pp_set_function[1] =
-{
-&writeNetworkDictCallBack,
-// Reset status word
-    };
 /*
  * PARAM
  * VT
- */UNS32 smart_velocity_pp_set_param[5] =
-{
-0x6081, 0x0, 4, 0, 0xFFFFFFFF
-// Reset status word
-    };
-
-char *smart_velocity_pp_set_error[2] =
+ */
+static const struct machine_step smart_velocity_pp_set_step[] =
 {
-"Velocity target set", "Cannot set the velocity target"
+  { MACHINE_SDO_WRITE, 0x6081, 0x0, 4, 0, 0, MACHINE_ARG_VALUE }, // Reset status word
 };
 
 struct state_machine_struct smart_velocity_pp_set_machine =
 {
-smart_velocity_pp_set_function, 1, smart_velocity_pp_set_param, 5, smart_velocity_pp_set_error
+  smart_velocity_pp_set_step, MACHINE_STEP_COUNT(smart_velocity_pp_set_step),
+  { "Velocity target set", "Cannot set the velocity target" }
 };
 
-void *smart_read_function[1] =
-{
-&readNetworkDictCallback
-// Read smartmotor status word 0
-    };
-
 /*param
  * object id
  * sub-object
  * type: 0 or visible_string
  */
-UNS32 smart_read_param[3] =
-{
-0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
-// Read smartmotor status word 0
-    };
-
-char *smart_read_error[2] =
+static const struct machine_step smart_read_step[] =
 {
-"Reg read", "Cannot read register"
+  { MACHINE_SDO_READ, 0, 0, 0, 0, 0, MACHINE_ARG_INDEX | MACHINE_ARG_SUBINDEX | MACHINE_ARG_TYPE }, // Read smartmotor status word 0
 };
 
 struct state_machine_struct smart_read_machine =
 {
-smart_read_function, 1, smart_read_param, 3, smart_read_error
+  smart_read_step, MACHINE_STEP_COUNT(smart_read_step),
+  { "Reg read", "Cannot read register" }
 };
 
-void *smart_statusword_function[1] =
+static const struct machine_step smart_statusword_step[] =
 {
-&readNetworkDictCallback
-// Read smartmotor status word 0
-    };
-UNS32 smart_statusword_param[3] =
-{
-0x2304, 0xFFFFFFFF, 0
-// Read smartmotor status word 0
-    };
-
-char *smart_statusword_error[2] =
-{
-"Status word read", "Cannot read status word0 register"
+  { MACHINE_SDO_READ, 0x2304, 0, 0, 0, 0, MACHINE_ARG_SUBINDEX }, // Read smartmotor status word 0
 };
 
 struct state_machine_struct smart_statusword_machine =
 {
-smart_statusword_function, 1, smart_statusword_param, 3, smart_statusword_error
+  smart_statusword_step, MACHINE_STEP_COUNT(smart_statusword_step),
+  { "Status word read", "Cannot read status word0 register" }
 };
 
-void *smart_reset_statusword_function[1] =
-{
-&writeNetworkDictCallBack,
-// Reset status word
-    };
-UNS32 smart_reset_statusword_param[5] =
-{
-0x6040, 0x0, 2, 0, 0x80
-// Reset status word
-    };
-
-char *smart_reset_statusword_error[2] =
+static const struct machine_step smart_reset_statusword_step[] =
 {
-"Status word cleared", "Cannot reset status word"
+  { MACHINE_SDO_WRITE, 0x6040, 0x0, 2, 0, 0x80, 0 }, // Reset status word
 };
 
 struct state_machine_struct smart_reset_statusword_machine =
 {
-smart_reset_statusword_function, 1, smart_reset_statusword_param, 5, smart_reset_statusword_error
+  smart_reset_statusword_step, MACHINE_STEP_COUNT(smart_reset_statusword_step),
+  { "Status word cleared", "Cannot reset status word" }
 };
 
-void *smart_origin_function[1] =
-{
-&writeNetworkDictCallBack,
-// Set origin
-    };
-UNS32 smart_origin_param[5] =
-{
-0x2202, 0x0, 4, 0, 0x00
-// Set origin
-    };
-
-char *smart_origin_error[2] =
+static const struct machine_step smart_origin_step[] =
 {
-"Origin set", "Cannot set origin"
+  { MACHINE_SDO_WRITE, 0x2202, 0x0, 4, 0, 0x00, 0 }, // Set origin
 };
 
 struct state_machine_struct smart_origin_machine =
 {
-smart_origin_function, 1, smart_origin_param, 5, smart_origin_error
+  smart_origin_step, MACHINE_STEP_COUNT(smart_origin_step),
+  { "Origin set", "Cannot set origin" }
 };
 
+void _machine_callback(CO_Data* d, UNS8 nodeId);
+static int machine_finalize(CO_Data *d, UNS8 nodeId, int result_value, int from_callback);
+static void machine_sdo_release(UNS8 nodeId, int from_callback);
+static void machine_queue_next(UNS8 nodeId, int from_callback);
+static void machine_step_timeout(CO_Data *d, UNS32 id);
+
 void _machine_init()
 {
   int i = 0;
@@ -1612,1508 +721,1338 @@ void _machine_init()
     motor_active[i] = 0;
     motor_started[i] = 0;
 
-    next_machine_size[i] = 0;
-    next_var_count[i] = 0;
-    var_count_total[i] = 0;
-    machine_state_index[i] = 0;
-    machine_state_param_index[i] = 0;
+    memset(&machine_context[i], 0, sizeof(machine_context[i]));
+    machine_context[i].timer = TIMER_NONE;
+    machine_queue[i].count = 0;
+    sdo_state[i] = MACHINE_SDO_IDLE;
 
-#ifndef SDO_SYNC
     pthread_mutex_init(&machine_mux[i], &Attr);
-#endif
   }
 
-#ifdef SDO_SYNC
-  pthread_mutex_init(&machine_mux, &Attr);
-  pthread_cond_init(&machine_run_cond, NULL);
-#endif
+  // il numero massimo di trasferimenti viene mantenuto: può essere impostato
+  // da riga di comando prima di load
+  memset(sdo_queue, 0, sizeof(sdo_queue));
+  sdo_inflight = 0;
 
   motor_active[0] = 1;
 }
 
 void _machine_destroy()
 {
-#ifndef SDO_SYNC
   int i = 0;
 
   for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
   {
     pthread_mutex_destroy(&machine_mux[i]);
   }
-#else
-  pthread_mutex_destroy(&machine_mux);
-#endif
 }
 
-void _machine_reset(CO_Data* d, UNS8 nodeId)
+/**
+ * Messaggio di errore della macchina in esecuzione sul motore.
+ */
+static char *machine_error_text(struct machine_context *context)
 {
-  int sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
-
-#ifdef CANOPENSHELL_VERBOSE
-  if(verbose_flag_state)
-  {
-    if((sdo_result != 0) && (sdo_result != 0xFF))
-    {
-      printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError, nodeId,
-          machine_state_index[nodeId], next_machine[nodeId][0]->error[1], sdo_result);
-    }
-  }
-#endif
-
-  motor_active[nodeId] = 0;
-  motor_started[nodeId] = 0;
+  if((context->machine_count == 0) || (context->machine[context->machine_index]->error[1] == NULL))
+    return "";
 
-  next_machine_size[nodeId] = 0;
-  next_var_count[nodeId] = 0;
-  var_count_total[nodeId] = 0;
-  machine_state_index[nodeId] = 0;
-  machine_state_param_index[nodeId] = 0;
-
-  if(args_ptr[nodeId] != NULL)
-  {
-    free(args_ptr[nodeId]);
-    args_ptr[nodeId] = NULL;
-    next_args[nodeId] = NULL;
-  }
+  return context->machine[context->machine_index]->error[1];
+}
 
-  if(next_machine[nodeId] != NULL)
+/**
+ * @remark: con un timer attivo va chiamata con il mutex di CanFestival, come
+ * avviene nei callback SDO e dei timer.
+ */
+static void machine_context_clear(struct machine_context *context)
+{
+  if(context->timer != TIMER_NONE)
   {
-    free(next_machine[nodeId]);
-    next_machine[nodeId] = NULL;
+    DelAlarm(context->timer);
+    context->timer = TIMER_NONE;
   }
 
-#ifndef SDO_SYNC
-  machine_run[nodeId] = 0;
-#endif
+  context->machine_count = 0;
+  context->machine_index = 0;
+  context->step_index = 0;
+  context->arg_count = 0;
+  context->arg_index = 0;
+  context->read_done = 0;
+  context->callback = NULL;
+  context->priority = MACHINE_PRIORITY_NORMAL;
 }
 
 /**
- * @TODO: adeguare i commenti
- */
-/**
- * Callback per le richieste di tipo SDO alla funzione _vsmart_start().
+ * Imposta il numero massimo di trasferimenti SDO contemporanei delle macchine
+ * a stati, su tutto il bus.
  *
- * @param d: puntatore al nodo canopen
- * @param nodeID - ID del nodo da cui proviene la risposta
+ * @input inflight_max: da 1 a SDO_MAX_SIMULTANEOUS_TRANSFERS, 0 per il valore
+ * predefinito SDO_MAX_SIMULTANEOUS_TRANSFERS
  *
- * @remark: In caso di errore, la macchina viene fermata e viene caricato il codice il relativo codice
- * nella variabile globale canopen_abort_code.
+ * @return:  0 -> valore impostato
+ *          -1 -> valore non valido
+ *
+ * @remark: con 1 i motori comunicano uno per volta, come con la vecchia
+ * opzione SDO_SYNC, ma alternandosi ad ogni passo invece che ad ogni sequenza.
+ * Il nuovo valore viene applicato alla conclusione del prossimo trasferimento.
  */
-
-void _machine_callback(CO_Data* d, UNS8 nodeId)
+int _machine_sdo_configure(int inflight_max)
 {
-  _machine_exe(d, nodeId, NULL, NULL, 0, 1, 0);
+  if((inflight_max < 0) || (inflight_max > SDO_MAX_SIMULTANEOUS_TRANSFERS))
+    return -1;
+
+  if(inflight_max == 0)
+    inflight_max = SDO_MAX_SIMULTANEOUS_TRANSFERS;
+
+  pthread_mutex_lock(&sdo_scheduler_mux);
+  sdo_inflight_max = inflight_max;
+  pthread_mutex_unlock(&sdo_scheduler_mux);
+
+  return 0;
 }
 
 /**
- * Inizializza i parametri del motore SmartMotor e lo abilita.
- *
- * @param d: puntatore al nodo CanOpen.
- * @param nodeId: ID del nodo con cui comunicare
- * @param callback: array di callback da cui viene presa la prossima funzione da eseguire alla fine della macchina a stati
- * @param callback_num: dimensione della matrice di callback
- * @param from_callback: indica se la funzione viene chiamata tramite un callback
- * @param var_count: numero di variabili contenute nella lista args
- * @param args: lista dei parametri da passare alla funzione successiva
+ * Toglie dalla coda il primo motore, partendo dalla priorità più alta.
  *
+ * @return: ID del motore, 0 se le code sono vuote
  */
-
-int _machine_exe(CO_Data *d, UNS8 nodeId, MachineCallback_t machine_callback,
-    struct state_machine_struct *machine[], int callback_num, int from_callback, int var_count, ...)
+static UNS8 machine_sdo_queue_pop(void)
 {
-  void *last_function = NULL;
-  UNS32 readNetworkDictCallback_result = 0;
+  struct machine_sdo_queue *queue;
+  int priority;
+  UNS8 nodeId;
 
-  int result_value = 0;
+  for(priority = MACHINE_PRIORITY_COUNT - 1; priority >= 0; priority--)
+  {
+    queue = &sdo_queue[priority];
 
-  int lock_value;
-  int i, j;
+    if(queue->count > 0)
+    {
+      nodeId = queue->node[queue->head];
+      queue->head = (queue->head + 1) % CANOPEN_NODE_NUMBER;
+      queue->count--;
+
+      return nodeId;
+    }
+  }
 
-  static int function_call_number[CANOPEN_NODE_NUMBER];
+  return 0;
+}
+
+static void machine_sdo_queue_remove(UNS8 nodeId)
+{
+  struct machine_sdo_queue *queue;
+  int priority;
+  int i;
 
-  if(callback_num != 0) // se la funzione non è stata richiamata dal callback
+  for(priority = 0; priority < MACHINE_PRIORITY_COUNT; priority++)
   {
-#ifndef SDO_SYNC
-    // Controllo se _machine_exe sia impegnata con lo stesso motore in un'altra
-    // operazione
-    if(nodeId != 0)
+    queue = &sdo_queue[priority];
+
+    for(i = 0; i < queue->count; i++)
     {
-      lock_value = pthread_mutex_lock(&machine_mux[nodeId]);
+      if(queue->node[(queue->head + i) % CANOPEN_NODE_NUMBER] != nodeId)
+        continue;
 
-      if(machine_run[nodeId] == 1)
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag_state)
-        {
-          printf("ERR[%d on node %x state %d]: %s (Operazione in corso)\n", InternalError, nodeId,
-              machine_state_index[nodeId], machine[0]->error[1]);
-        }
-#endif
+      // compatto la coda mantenendo l'ordine degli altri motori
+      for(; i < queue->count - 1; i++)
+        queue->node[(queue->head + i) % CANOPEN_NODE_NUMBER] = queue->node[(queue->head + i + 1)
+            % CANOPEN_NODE_NUMBER];
 
-        lock_value = pthread_mutex_unlock(&machine_mux[nodeId]);
+      queue->count--;
+      return;
+    }
+  }
+}
 
-        fflush(stdout);
+/**
+ * Chiede una linea SDO per il passo caricato nel contesto del motore.
+ *
+ * @return: 1 se il passo può essere inviato subito, 0 se il motore è stato
+ * messo in coda: il passo verrà inviato da machine_sdo_release
+ */
+static int machine_sdo_request(UNS8 nodeId, int priority)
+{
+  int granted = 0;
+  int i;
 
-        machine_callback(d, nodeId, 0, 0, 1);
-        return 1;
-      }
-    }
-    else
+  pthread_mutex_lock(&sdo_scheduler_mux);
+
+  // non passo davanti ai motori già in coda con la stessa priorità o più alta
+  if(sdo_inflight < sdo_inflight_max)
+  {
+    granted = 1;
+
+    for(i = priority; i < MACHINE_PRIORITY_COUNT; i++)
     {
-      if(motor_active_number == 0)
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag_state)
-        {
-          printf("ERR[%d on node %x state %d]: Nessun motore attivo\n", InternalError, nodeId,
-              machine_state_index[nodeId]);
-        }
-#endif
+      if(sdo_queue[i].count > 0)
+        granted = 0;
+    }
+  }
 
-        machine_callback(d, nodeId, 0, 0, 1);
-        return 1;
-      }
+  if(granted)
+  {
+    sdo_state[nodeId] = MACHINE_SDO_INFLIGHT;
+    sdo_inflight++;
+  }
+  else
+  {
+    sdo_state[nodeId] = MACHINE_SDO_WAITING;
+    sdo_queue[priority].node[(sdo_queue[priority].head + sdo_queue[priority].count)
+        % CANOPEN_NODE_NUMBER] = nodeId;
+    sdo_queue[priority].count++;
+  }
 
-      for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
-      {
+  pthread_mutex_unlock(&sdo_scheduler_mux);
 
-        if(motor_active[i] > 0)
-        {
-          lock_value = pthread_mutex_lock(&machine_mux[i]);
+  return granted;
+}
 
-          if(machine_run[i] == 1)
-          {
-#ifdef CANOPENSHELL_VERBOSE
-            if(verbose_flag_state)
-            {
-              printf("ERR[%d on node %x state %d]: %s (Operazione in corso node 0)\n",
-                  InternalError, i, machine_state_index[i], machine[0]->error[1]);
+void _machine_reset(CO_Data* d, UNS8 nodeId)
+{
+  int sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-              printf("callback num: %d\n", callback_num);
-            }
+#ifdef CANOPENSHELL_VERBOSE
+  if(verbose_flag_state)
+  {
+    if((sdo_result != 0) && (sdo_result != 0xFF))
+    {
+      printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError, nodeId,
+          machine_context[nodeId].step_index, machine_error_text(&machine_context[nodeId]),
+          sdo_result);
+    }
+  }
 #endif
 
-            lock_value = pthread_mutex_unlock(&machine_mux[i]);
-
-            fflush(stdout);
-            machine_callback(d, i, 0, 0, 1);
-            return 1;
-          }
+  motor_active[nodeId] = 0;
+  motor_started[nodeId] = 0;
 
-          lock_value = pthread_mutex_unlock(&machine_mux[i]);
-        }
-      }
+  machine_context_clear(&machine_context[nodeId]);
 
-      // Controllo che sia attivo almeno un motore
-    }
+  // _machine_reset viene chiamata al boot del nodo, dal thread CAN
+  machine_sdo_release(nodeId, 1);
 
-#else
-    lock_value = pthread_mutex_lock(&machine_mux);
+  // come la sequenza in corso, anche quelle in attesa vengono scartate senza
+  // chiamare il callback: il nodo va configurato di nuovo
+  pthread_mutex_lock(&machine_mux[nodeId]);
+  machine_queue[nodeId].count = 0;
+  machine_run[nodeId] = 0;
+  pthread_mutex_unlock(&machine_mux[nodeId]);
+}
 
-    if(machine_run == 1)
-    {
-      printf("machine wait %d\n", nodeId);
-      pthread_cond_wait(&machine_run_cond, &machine_mux);
-    }
+static void machine_release(UNS8 nodeId)
+{
+  int lock_value;
 
-    printf("machine %d\n", nodeId);
-#endif
+  lock_value = pthread_mutex_lock(&machine_mux[nodeId]);
+  machine_run[nodeId] = 0;
+  lock_value = pthread_mutex_unlock(&machine_mux[nodeId]);
 
-    if(machine_state_index[nodeId] > 0)
-    {
 #ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag_state)
-      {
-        printf("WARN[%d on node %x state %d]: Qualcuno è entrato senza bussare...\n", InternalError,
-            nodeId, machine_state_index[nodeId]);
-      }
+  if(verbose_flag_state)
+  {
+    if(lock_value != 0)
+      printf("ERR[%d on node %x]: Impossibile sbloccare il mutex: %d\n", InternalError, nodeId,
+          lock_value);
+  }
 #endif
+}
 
-#ifndef SDO_SYNC
-      lock_value = pthread_mutex_unlock(&machine_mux[nodeId]);
-#else
-      lock_value = pthread_mutex_unlock(&machine_mux);
-#endif
-      return -1;
-    }
+/**
+ * Chiude la sequenza del motore, lo libera e chiama il callback dell'utente.
+ * Se il motore aveva una linea SDO o era in coda, la linea passa ad un altro
+ * motore. Dopo il callback, se il motore è ancora libero, parte la prima
+ * richiesta in attesa.
+ *
+ * @return: result_value
+ */
+static int machine_finalize(CO_Data *d, UNS8 nodeId, int result_value, int from_callback)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  MachineCallback_t callback = context->callback;
+  int machine_state = context->step_index;
+  int read_done = context->read_done;
+  UNS32 read_result = context->read_result;
 
-    // se non è una richiesta broadcast
-    if(nodeId != 0)
-    {
-#ifndef SDO_SYNC
-      machine_run[nodeId] = 1;
-#else
-      machine_run = 1;
-#endif
-      callback_user[nodeId] = machine_callback;
-    }
+  machine_context_clear(context);
+  machine_sdo_release(nodeId, from_callback);
+  machine_release(nodeId);
+
+  if(callback != NULL)
+  {
+    if((result_value == 0) && read_done)
+      callback(d, nodeId, machine_state, 1, read_result);
     else
-    {
-      for(i = 1; i < CANOPEN_NODE_NUMBER; i++)
-      {
-        if(motor_active[i] > 0)
-        {
-          callback_user[i] = machine_callback;
-        }
-      }
+      callback(d, nodeId, machine_state, 0, result_value);
+  }
 
-#ifdef SDO_SYNC
-      machine_run = 1;
-#endif
-    }
+  fflush(stdout);
 
-#ifndef SDO_SYNC
-    lock_value = pthread_mutex_unlock(&machine_mux[nodeId]);
-#else
-    lock_value = pthread_mutex_unlock(&machine_mux);
-#endif
+  // il callback può avviare una nuova sequenza sul motore, che prosegue così
+  // quella appena conclusa e passa davanti alle richieste in attesa
+  machine_queue_next(nodeId, from_callback);
 
-    // Memorizzo il vettore con le prossime funzioni da eseguire
-    if(callback_num == 0)
-    {
-#ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag_state)
-      {
-        printf("ERR[%d on node %x state %d]: Nessuna funzione\n", InternalError, nodeId,
-            machine_state_index[nodeId]);
-      }
-#endif
+  return result_value;
+}
 
-      result_value = 1;
-      goto finalize;
-    }
+/**
+ * Copia nel contesto del motore il prossimo passo della macchina in
+ * esecuzione, sostituendo i campi indicati in arg con gli argomenti della
+ * richiesta.
+ *
+ * @return:  0 -> passo caricato
+ *          -1 -> argomenti insufficienti
+ */
+static int machine_step_load(struct machine_context *context)
+{
+  struct machine_step *step = &context->step;
+  int arg_needed = 0;
+  UNS8 arg;
 
-    // memorizzo il numero di macchine presenti nell'array dei callback
-    if(nodeId != 0)
-      next_machine_size[nodeId] = callback_num;
-    else  // se è un messaggio broadcast
-    {
-      for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
-      {
-        if(motor_active[i] > 0)
-          next_machine_size[i] = callback_num;
-      }
-    }
+  *step = context->machine[context->machine_index]->step[context->step_index];
 
-    // salvo l'array dei callback
-    if(nodeId != 0)
-    {
-      if(next_machine[nodeId] == NULL)
-      {
-        next_machine[nodeId] = malloc(
-            next_machine_size[nodeId] * sizeof(struct state_machine_struct *));
+  for(arg = step->arg; arg != 0; arg >>= 1)
+    arg_needed += arg & 0x1;
 
-        if(next_machine[nodeId] == NULL)
-        {
-#ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag_state)
-          {
-            printf(
-                "ERR[%d on node %x state %d]: %s (memoria finita per allocare next_machine[%d])\n",
-                InternalError, nodeId, machine_state_index[nodeId],
-                next_machine[nodeId][0]->error[1], nodeId);
-          }
-#endif
+  if(context->arg_index + arg_needed > context->arg_count)
+    return -1;
 
-          result_value = 1;
-          goto finalize;
-        }
-      }
+  if(step->arg & MACHINE_ARG_INDEX)
+    step->index = context->args[context->arg_index++];
+
+  if(step->arg & MACHINE_ARG_SUBINDEX)
+    step->subindex = context->args[context->arg_index++];
+
+  if(step->arg & MACHINE_ARG_SIZE)
+    step->size = context->args[context->arg_index++];
+
+  if(step->arg & MACHINE_ARG_TYPE)
+    step->type = context->args[context->arg_index++];
+
+  if(step->arg & MACHINE_ARG_VALUE)
+    step->value = (UNS32) context->args[context->arg_index++];
+
+  if(step->arg & MACHINE_ARG_STRING)
+    step->string = (const char *) context->args[context->arg_index++];
+
+  return 0;
+}
+
+/**
+ * Invia il passo caricato nel contesto del motore.
+ *
+ * @return:  0 -> richiesta SDO inviata, la sequenza riprende dal callback
+ *           1 -> passo concluso, non è prevista risposta
+ *          -1 -> errore di invio
+ */
+static int machine_step_send(CO_Data *d, UNS8 nodeId, int from_callback)
+{
+  struct machine_step *step = &machine_context[nodeId].step;
+  UNS8 send_result = 0;
+
+  // chiamo EnterMutex e LeaveMutex solo se non sono in un callback
+  if(!from_callback)
+    EnterMutex();
+
+  // il tempo va preso prima dell'invio: la risposta può arrivare prima che la
+  // funzione di invio ritorni
+  if(step->operation != MACHINE_NMT)
+    clock_gettime(CLOCK_MONOTONIC, &machine_context[nodeId].step_time);
+
+  switch(step->operation)
+  {
+    case MACHINE_NMT:
+      masterSendNMTstateChange(d, nodeId, step->value);
+      break;
+
+    case MACHINE_SDO_WRITE:
+      if(step->type == visible_string)
+        send_result = writeNetworkDictCallBack(d, nodeId, step->index, step->subindex, step->size,
+            step->type, (char *) step->string, _machine_callback, 0);
       else
-      {
-        free(next_machine[nodeId]);
-        next_machine[nodeId] = NULL;
-        next_machine[nodeId] = malloc(
-            next_machine_size[nodeId] * sizeof(struct state_machine_struct *));
+        send_result = writeNetworkDictCallBack(d, nodeId, step->index, step->subindex, step->size,
+            step->type, &step->value, _machine_callback, 0);
+      break;
+
+    case MACHINE_SDO_READ:
+      send_result = readNetworkDictCallback(d, nodeId, step->index, step->subindex, step->type,
+          _machine_callback, 0);
+      break;
+  }
 
-        if(next_machine[nodeId] == NULL)
-        {
-#ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag_state)
-          {
-            printf(
-                "ERR[%d on node %x state %d]: %s (memoria finita per allocare next_machine[%d])\n",
-                InternalError, nodeId, machine_state_index[nodeId],
-                next_machine[nodeId][0]->error[1], nodeId);
-          }
-#endif
+  // il timeout parte sotto il mutex, per cui non può arrivare prima la risposta
+  if((send_result != 0xFF) && (step->operation != MACHINE_NMT))
+    machine_context[nodeId].timer = SetAlarm(d, nodeId, machine_step_timeout,
+        MS_TO_TIMEVAL(step->timeout_ms ? step->timeout_ms : MACHINE_SDO_TIMEOUT_MS), 0);
 
-          result_value = 1;
-          goto finalize;
-        }
-      }
+  if(!from_callback)
+    LeaveMutex();
 
-      for(i = 0; i < next_machine_size[nodeId]; i++)
-        next_machine[nodeId][i] = machine[i];
-    }
-    else
-    {
-      for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
-      {
-        if(motor_active[i] > 0)
-        {
-          if(next_machine[i] == NULL)
-          {
-            next_machine[i] = malloc(next_machine_size[i] * sizeof(struct state_machine_struct *));
+  if(send_result == 0xFF)
+    return -1;
 
-            if(next_machine[i] == NULL)
-            {
-#ifdef CANOPENSHELL_VERBOSE
-              if(verbose_flag_state)
-              {
-                printf(
-                    "ERR[%d on node %x state %d]: %s (memoria finita per allocare next_machine[%d])\n",
-                    InternalError, i, machine_state_index[i], next_machine[i][0]->error[1], i);
-              }
-#endif
+  if(step->operation == MACHINE_NMT)
+    return 1;
 
-              result_value = 1;
-              goto finalize;
-            }
-          }
-          else
-          {
-            free(next_machine[i]);
-            next_machine[i] = NULL;
-            next_machine[i] = malloc(next_machine_size[i] * sizeof(struct state_machine_struct *));
+  return 0;
+}
 
-            if(next_machine[i] == NULL)
-            {
+/**
+ * Chiude la sequenza del motore dopo un errore di invio.
+ *
+ * @return: 1
+ */
+static int machine_send_error(CO_Data *d, UNS8 nodeId, int from_callback)
+{
 #ifdef CANOPENSHELL_VERBOSE
-              if(verbose_flag_state)
-              {
-                printf(
-                    "ERR[%d on node %x state %d]: %s (memoria finita per allocare next_machine[%d])\n",
-                    InternalError, i, machine_state_index[i], next_machine[i][0]->error[1], i);
-              }
+  if(verbose_flag_state)
+  {
+    printf("ERR[%d on node %x state %d]: %s (writeNetwork error)\n", InternalError, nodeId,
+        machine_context[nodeId].step_index, machine_error_text(&machine_context[nodeId]));
+  }
 #endif
 
-              result_value = 1;
-              goto finalize;
-            }
-          }
-        }
+  return machine_finalize(d, nodeId, 1, from_callback);
+}
 
-        for(j = 0; j < next_machine_size[i]; j++)
-          next_machine[i][j] = machine[j];
-      }
-    }
+/**
+ * Avvia il passo caricato nel contesto del motore. I passi SDO aspettano dallo
+ * scheduler una linea libera.
+ *
+ * @return: come machine_step_send; 0 anche quando il motore è in coda
+ */
+static int machine_step_start(CO_Data *d, UNS8 nodeId, int from_callback)
+{
+  struct machine_context *context = &machine_context[nodeId];
 
-    // se è la prima funzione e se ci entro per la prima volta, mi salvo le variabili
-    if(var_count != 0)
-    {
-      if(nodeId != 0)
-      {
-        next_var_count[nodeId] = var_count;
-        var_count_total[nodeId] = var_count;
+  if((context->step.operation != MACHINE_NMT) && !machine_sdo_request(nodeId, context->priority))
+    return 0;
 
-        if(args_ptr[nodeId] == NULL)
-        {
-          args_ptr[nodeId] = malloc(next_var_count[nodeId] * sizeof(UNS32));
-          if(args_ptr[nodeId] == NULL)
-          {
-#ifdef CANOPENSHELL_VERBOSE
-            if(verbose_flag_state)
-            {
-              printf("ERR[%d on node %x state %d]: %s (memoria finita per allocare args_ptr[%d])\n",
-                  InternalError, nodeId, machine_state_index[nodeId],
-                  next_machine[nodeId][0]->error[1], nodeId);
-            }
-#endif
+  return machine_step_send(d, nodeId, from_callback);
+}
 
-            result_value = 1;
-            goto finalize;
-          }
-        }
-      }
-      else
-      {
-        for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
-        {
-          if(motor_active[i] > 0)
-          {
-            next_var_count[i] = var_count;
-            var_count_total[i] = var_count;
-
-            if(args_ptr[i] == NULL)
-            {
-              args_ptr[i] = malloc(next_var_count[i] * sizeof(UNS32));
-              if(args_ptr[i] == NULL)
-              {
-#ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  printf(
-                      "ERR[%d on node %x state %d]: %s (memoria finita per allocare args_ptr[%d])\n",
-                      InternalError, i, machine_state_index[i], next_machine[i][0]->error[1], i);
-                }
-#endif
+/**
+ * Libera la linea SDO del motore, o lo toglie dalla coda, e invia i passi dei
+ * motori in coda finché ci sono linee libere.
+ */
+static void machine_sdo_release(UNS8 nodeId, int from_callback)
+{
+  UNS8 dispatch[CANOPEN_NODE_NUMBER];
+  int dispatch_count = 0;
+  UNS8 next_node;
+  int i;
 
-                result_value = 1;
-                goto finalize;
-              }
-            }
-          }
-        }
-      }
+  pthread_mutex_lock(&sdo_scheduler_mux);
 
-      va_list args;
-      va_start(args, var_count);
+  if(sdo_state[nodeId] == MACHINE_SDO_INFLIGHT)
+    sdo_inflight--;
+  else if(sdo_state[nodeId] == MACHINE_SDO_WAITING)
+    machine_sdo_queue_remove(nodeId);
 
-      if(nodeId != 0)
-      {
-        for(i = 0; i < var_count; i++)
-          args_ptr[nodeId][i] = va_arg(args, UNS32);
-      }
-      else
-      {
-        for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
-        {
-          if(motor_active[i] > 0)
-          {
-            for(j = 0; j < var_count; j++)
-              args_ptr[i][j] = va_arg(args, UNS32);
-          }
-        }
-      }
+  sdo_state[nodeId] = MACHINE_SDO_IDLE;
 
-      va_end(args);
+  while(sdo_inflight < sdo_inflight_max)
+  {
+    next_node = machine_sdo_queue_pop();
 
-      if(nodeId != 0)
-        next_args[nodeId] = args_ptr[nodeId];
-      else
-      {
-        for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
-        {
-          if(motor_active[i] > 0)
-          {
-            next_args[i] = args_ptr[nodeId];
-          }
-        }
-      }
-    }
+    if(next_node == 0)
+      break;
+
+    sdo_state[next_node] = MACHINE_SDO_INFLIGHT;
+    sdo_inflight++;
+    dispatch[dispatch_count++] = next_node;
   }
-  else // if(callback_num != 0) // se la funzione non è stata richiamata dal callback
+
+  pthread_mutex_unlock(&sdo_scheduler_mux);
+
+  // invio fuori dal mutex dello scheduler: un errore di invio chiude la
+  // sequenza, che a sua volta libera la linea
+  for(i = 0; i < dispatch_count; i++)
   {
-    // Se al ritorno della callback l'indice è zero, vuol dire che è
-    // stato resettato tutto
-    if(machine_state_index[nodeId] <= 0)
-    {
-#ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag_state)
-      {
-        printf("ERR[%d on node %x state %d]: Errore al ritorno dal callback\n", InternalError,
-            nodeId, machine_state_index[nodeId]);
-      }
-#endif
+    if(machine_step_send(machine_context[dispatch[i]].d, dispatch[i], from_callback) < 0)
+      machine_send_error(machine_context[dispatch[i]].d, dispatch[i], from_callback);
+  }
+}
 
-      fflush(stdout);
-      result_value = 1;
-      goto finalize;
-    }
-    else
+/**
+ * Esegue la sequenza del motore fino alla prossima richiesta SDO, che
+ * riprenderà dal callback, oppure fino alla sua conclusione.
+ *
+ * @return: 0 se la sequenza è in corso o è terminata correttamente, 1 in caso
+ * di errore
+ */
+static int machine_next(CO_Data *d, UNS8 nodeId, int from_callback)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  struct state_machine_struct *machine;
+  int send_result;
+
+  while(1)
+  {
+    machine = context->machine[context->machine_index];
+
+    while(context->step_index < machine->step_count)
     {
-      if(machine_state_index[nodeId] > next_machine[nodeId][0]->function_size)
+      if(machine_step_load(context) < 0)
       {
 #ifdef CANOPENSHELL_VERBOSE
         if(verbose_flag_state)
         {
-          printf(
-              "WARN[%d on node %x state %d]: Qualcuno si è intrufolato dalla porta posteriore...\n",
-              InternalError, nodeId, machine_state_index[nodeId]);
-
-          printf("Il numero di chiamate a questa funzione è: %d\n", function_call_number[nodeId]);
+          printf("ERR[%d on node %x state %d]: %s (argomenti insufficienti)\n", InternalError,
+              nodeId, context->step_index, machine_error_text(context));
         }
 #endif
+
+        return machine_finalize(d, nodeId, 1, from_callback);
       }
 
+      // il passo viene contato prima dell'invio: la risposta può arrivare
+      // prima che la funzione di invio ritorni
+      context->step_index++;
+      context->read_done = 0;
+      context->attempt = 1;
+
+      send_result = machine_step_start(d, nodeId, from_callback);
+
+      if(send_result < 0)
+        return machine_send_error(d, nodeId, from_callback);
+
+      // richiesta inviata o motore in coda per una linea SDO
+      if(send_result == 0)
+        return 0;
+    }
+
 #ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag_state)
-      {
-        if(function_call_number[nodeId] < 1)
-          printf("WARN[%d on node %x state %d]: Sei andato un po' troppo veloce...\n",
-              InternalError, nodeId, machine_state_index[nodeId]);
-      }
+    if(verbose_flag)
+    {
+      if(machine->error[0] != NULL)
+        printf("SUCC[node %x]: %s\n", nodeId, machine->error[0]);
+    }
 #endif
 
-    }
+    if(context->machine_index == context->machine_count - 1)
+      break;
+
+    // avvio la macchina accodata
+    context->machine_index++;
+    context->step_index = 0;
   }
 
-  last_function = NULL;
+  return machine_finalize(d, nodeId, 0, from_callback);
+}
+
+/**
+ * Raccoglie la risposta della richiesta SDO in corso sul motore.
+ *
+ * @return:  0 -> passo concluso
+ *           1 -> errore, la sequenza va chiusa
+ *           2 -> il passo va ripetuto
+ *          -1 -> trasferimento non concluso o non associato al motore, il
+ *                callback va ignorato
+ */
+static int machine_step_result(CO_Data *d, UNS8 nodeId)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  struct machine_step *step = &context->step;
+  int sdo_result;
+  UNS8 line = 0;
+  UNS8 i;
 
-  // Se non è la prima volta che entro nella funzione, è il callback che mi ha fatto rientrare
-  // qui. Quindi raccolgo la risposta e continuo con la macchina a stati.
-  if(nodeId != 0)
+  for(i = 0; i < SDO_MAX_SIMULTANEOUS_TRANSFERS; i++)
+  {
+    if((d->transfers[i].state != SDO_RESET) && (d->transfers[i].CliServNbr == nodeId))
+    {
+      line = i;
+      break;
+    }
+  }
+
+  if(d->transfers[line].state == SDO_ABORTED_INTERNAL)
   {
-    if(machine_state_index[nodeId] != 0)
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag_state)
     {
-      int sdo_result;
-      UNS8 line = 0;
+      printf("ERR[%d on node %x state %d]: %s (Aborted internal code: %x)\n", InternalError,
+          nodeId, context->step_index, machine_error_text(context), d->transfers[line].abortCode);
+
+      AbortCodeTranslate(d->transfers[line].abortCode, error_text);
+      printf("Reason: %s\n", error_text);
+    }
+#endif
 
-      UNS8 i;
+    sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-      for(i = 0; i < SDO_MAX_SIMULTANEOUS_TRANSFERS; i++)
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag_state)
+    {
+      if((sdo_result != 0) && (sdo_result != 0xFF))
       {
-        if((d->transfers[i].state != SDO_RESET) && (d->transfers[i].CliServNbr == nodeId))
+        printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError, nodeId,
+            context->step_index, machine_error_text(context), sdo_result);
+      }
+    }
+#endif
+
+    return 1;
+  }
+
+  if(step->operation == MACHINE_SDO_WRITE)
+  {
+    sdo_result = getWriteResultNetworkDict(d, nodeId, &canopen_abort_code);
+    switch(sdo_result)
+    {
+      case SDO_DOWNLOAD_IN_PROGRESS:
+      case SDO_UPLOAD_IN_PROGRESS:
+        // il trasferimento non è concluso: la linea ed il callback restano
+        // associati al motore, che riprende dal prossimo callback
+#ifdef CANOPENSHELL_VERBOSE
+        if(verbose_flag_state)
         {
-          line = i;
-          break;
+          printf("WARN[%d on node %x state %d]: Download in progress (getWrite)\n", InternalError,
+              nodeId, context->step_index);
         }
-      }
+#endif
+        return -1;
+
+      case SDO_FINISHED:
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-      switch(d->transfers[line].state)
-      {
-        case SDO_ABORTED_INTERNAL:
 #ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag_state)
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
           {
-            printf("ERR[%d on node %x state %d]: %s (Aborted internal code: %x)\n", InternalError,
-                nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                d->transfers[line].abortCode);
-
-            AbortCodeTranslate(d->transfers[line].abortCode, error_text);
-            printf("Reason: %s\n", error_text);
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
           }
+        }
 #endif
 
-          sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
-
+        if(canopen_abort_code > 0)
+        {
 #ifdef CANOPENSHELL_VERBOSE
           if(verbose_flag_state)
           {
-            if((sdo_result != 0) && (sdo_result != 0xFF))
-            {
-              printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                  nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                  sdo_result);
-            }
+            printf("ERR[%d on node %x state %d]: %s (Canopen abort code %x)\n", CANOpenError,
+                nodeId, context->step_index, machine_error_text(context), canopen_abort_code);
           }
 #endif
+          return 1;
+        }
+        return 0;
 
-          result_value = 1;
-          goto finalize;
-          break;
+      case SDO_ABORTED_RCV:
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-        default:
-          if(next_machine[nodeId][0]->function[machine_state_index[nodeId] - 1]
-              == &writeNetworkDictCallBack)
+#ifdef CANOPENSHELL_VERBOSE
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
           {
-            function_call_number[nodeId]--;
-            last_function = &writeNetworkDictCallBack;
-
-            sdo_result = getWriteResultNetworkDict(d, nodeId, &canopen_abort_code);
-            switch(sdo_result)
-            {
-              case SDO_DOWNLOAD_IN_PROGRESS:
-              case SDO_UPLOAD_IN_PROGRESS:
-                while((sdo_result = getWriteResultNetworkDict(d, nodeId, &canopen_abort_code))
-                    != SDO_DOWNLOAD_IN_PROGRESS)
-                  printf("ERR[%d on node %x state %d]: Download in progress (getWrite)\n",
-                      InternalError, nodeId, machine_state_index[nodeId]);
-                ;
-                break;
-
-              case SDO_FINISHED:
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
+          }
 
-#ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-                }
+          printf("ERR[%d on node %x state %d]: %s (Canopen abort code %x)\n", CANOpenError,
+              nodeId, context->step_index, machine_error_text(context), canopen_abort_code);
+        }
 #endif
 
-                if(canopen_abort_code > 0)
-                {
-#ifdef CANOPENSHELL_VERBOSE
-                  if(verbose_flag_state)
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (Canopen abort code %x)\n",
-                        CANOpenError, nodeId, machine_state_index[nodeId],
-                        next_machine[nodeId][0]->error[1], canopen_abort_code);
-                  }
-#endif
-                  result_value = 1;
-                  goto finalize;
-                }
-                break;
+        // come per la lettura, provo a rieseguire la stessa scrittura
+        return 2;
 
-              case SDO_ABORTED_INTERNAL:
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+      case SDO_ABORTED_INTERNAL:
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-                }
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
+          {
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
+          }
+        }
 #endif
-                break;
+        // la scrittura non è arrivata al motore
+        return 1;
 
-              case SDO_ABORTED_RCV:
+      case SDO_RESET:
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  printf("ERR[%d on node %x state %d]: %s (SDO getWriteResult error %d)\n",
-                      InternalError, nodeId, machine_state_index[nodeId],
-                      next_machine[nodeId][0]->error[1], sdo_result);
-                }
-
-                AbortCodeTranslate(d->transfers[line].abortCode, error_text);
-                printf("Reason: %s\n", error_text);
-#endif
+        if(verbose_flag_state)
+        {
+          printf("ERR[%d on node %x state %d]: %s (SDO getWriteResult error %d)\n", InternalError,
+              nodeId, context->step_index, machine_error_text(context), sdo_result);
 
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+          AbortCodeTranslate(d->transfers[line].abortCode, error_text);
+          printf("Reason: %s\n", error_text);
 
-#ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-                }
+          fflush(stdout);
+        }
 #endif
+        return -1;
 
-                //machine_state_index[nodeId]--; // provo a rieseguire la stessa funzione
-                //machine_state_param_index[nodeId] -= 5;
-                result_value = 1;
-                goto finalize;
-                break;
-
-              case SDO_RESET:
+      default:
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  printf("ERR[%d on node %x state %d]: %s (SDO getWriteResult error %d)\n",
-                      InternalError, nodeId, machine_state_index[nodeId],
-                      next_machine[nodeId][0]->error[1], sdo_result);
-
-                  AbortCodeTranslate(d->transfers[line].abortCode, error_text);
-                  printf("Reason: %s\n", error_text);
-
-                  printf("Il numero di chiamate a questa funzione è: %d\n",
-                      function_call_number[nodeId]);
+        if(verbose_flag_state)
+        {
+          printf("ERR[%d on node %x state %d]: %s (SDO getWriteResult error %d)\n", InternalError,
+              nodeId, context->step_index, machine_error_text(context), sdo_result);
 
-                  fflush(stdout);
-                }
+          AbortCodeTranslate(d->transfers[line].abortCode, error_text);
+          printf("Reason: %s\n", error_text);
+        }
 #endif
-                return 1;
-                break;
 
-              default:
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  printf("ERR[%d on node %x state %d]: %s (SDO getWriteResult error %d)\n",
-                      InternalError, nodeId, machine_state_index[nodeId],
-                      next_machine[nodeId][0]->error[1], sdo_result);
-
-                  AbortCodeTranslate(d->transfers[line].abortCode, error_text);
-                  printf("Reason: %s\n", error_text);
-                  printf("Il numero 2 di chiamate a questa funzione è: %d\n",
-                      function_call_number[nodeId]);
-                }
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
+          {
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
+          }
+        }
 #endif
+        return 1;
+    }
+  }
+
+  if(step->operation == MACHINE_SDO_READ)
+  {
+    char result_string[64];
+    UNS32 size;
 
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+    if(step->type == visible_string)
+    {
+      size = sizeof(result_string);
+      sdo_result = getReadResultNetworkDict(d, nodeId, result_string, &size, &canopen_abort_code);
+      context->read_result = atol(result_string);
+    }
+    else
+    {
+      size = sizeof(context->read_result);
+      sdo_result = getReadResultNetworkDict(d, nodeId, &context->read_result, &size,
+          &canopen_abort_code);
+    }
 
+    switch(sdo_result)
+    {
+      case SDO_DOWNLOAD_IN_PROGRESS:
+      case SDO_UPLOAD_IN_PROGRESS:
+        // come per la scrittura, il valore verrà letto al prossimo callback
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-                }
+        if(verbose_flag_state)
+        {
+          printf("WARN[%d on node %x state %d]: Upload in progress (getRead)\n", InternalError,
+              nodeId, context->step_index);
+        }
 #endif
+        return -1;
 
-                result_value = 1;
-                goto finalize;
-                break;
-            }
-          }
-          else if(next_machine[nodeId][0]->function[machine_state_index[nodeId] - 1]
-              == &readNetworkDictCallback)
-          {
-            function_call_number[nodeId]--;
-            last_function = &readNetworkDictCallback;
-
-            if(args_ptr[nodeId][2] == 9)
-            {
-              char readNetworkDictCallback_result_string[64];
-
-              UNS32 size = sizeof(readNetworkDictCallback_result_string);
-              sdo_result = getReadResultNetworkDict(d, nodeId, readNetworkDictCallback_result_string, &size,
-                                &canopen_abort_code);
-
-              readNetworkDictCallback_result = atol(readNetworkDictCallback_result_string);
-            }
-            else
-            {
-              UNS32 size = 64;
-
-              sdo_result = getReadResultNetworkDict(d, nodeId, &readNetworkDictCallback_result, &size,
-                  &canopen_abort_code);
-            }
-
-            switch(sdo_result)
-            {
-              case SDO_DOWNLOAD_IN_PROGRESS:
-              case SDO_UPLOAD_IN_PROGRESS:
-                if(args_ptr[nodeId][2] == 9)
-                {
-                  char readNetworkDictCallback_result_string[64];
-
-                  UNS32 size = sizeof(readNetworkDictCallback_result_string);
-
-                  while((sdo_result = getReadResultNetworkDict(d, nodeId,
-                      readNetworkDictCallback_result_string, &size, &canopen_abort_code)) != SDO_DOWNLOAD_IN_PROGRESS)
-                    printf("ERR[%d on node %x state %d]: Download in progress (getRead)\n",
-                        InternalError, nodeId, machine_state_index[nodeId]);
-
-                  readNetworkDictCallback_result = atol(readNetworkDictCallback_result_string);
-                }
-                else
-                {
-                  UNS32 size = 64;
-
-                  while((sdo_result = getReadResultNetworkDict(d, nodeId,
-                      &readNetworkDictCallback_result, &size, &canopen_abort_code)) != SDO_DOWNLOAD_IN_PROGRESS)
-                    printf("ERR[%d on node %x state %d]: Download in progress (getRead)\n",
-                        InternalError, nodeId, machine_state_index[nodeId]);
-                }
-                break;
-
-              case SDO_FINISHED:
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+      case SDO_FINISHED:
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-                }
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
+          {
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
+          }
+        }
 #endif
 
-                if(canopen_abort_code > 0)
-                {
+        if(canopen_abort_code > 0)
+        {
 #ifdef CANOPENSHELL_VERBOSE
-                  if(verbose_flag_state)
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (Canopen abort code %x)\n",
-                        CANOpenError, nodeId, machine_state_index[nodeId],
-                        next_machine[nodeId][0]->error[1], canopen_abort_code);
-                  }
+          if(verbose_flag_state)
+          {
+            printf("ERR[%d on node %x state %d]: %s (Canopen abort code %x)\n", CANOpenError,
+                nodeId, context->step_index, machine_error_text(context), canopen_abort_code);
+          }
 #endif
+          return 1;
+        }
 
-                  result_value = 1;
-                  goto finalize;
-                }
+        context->read_done = 1;
+        return 0;
 
-                if(callback_user[nodeId] != NULL)
-                {
-                  // Nel caso in cui non è l'ultima funzione oppure ci sono altre
-                  // macchine accodate, eseguo ora la funzione
+      case SDO_ABORTED_RCV:
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-                  if((machine_state_index[nodeId] != next_machine[nodeId][0]->function_size)
-                      || ((next_machine[nodeId] != NULL) && (next_machine_size[nodeId] > 1)))
-                    callback_user[nodeId](d, nodeId, machine_state_index[nodeId], 1,
-                        readNetworkDictCallback_result);
-                }
 #ifdef CANOPENSHELL_VERBOSE
-                else
-                {
-                  if(verbose_flag_state)
-                  {
-                    printf("WARN[%d on node %x state %d]: Lettura senza funzione di callback \n",
-                        InternalError, nodeId, machine_state_index[nodeId]);
-                  }
-                }
-#endif
-
-                break;
-
-              case SDO_ABORTED_RCV:
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
+          {
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
+          }
 
-#ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-
-                  printf("ERR[%d on node %x state %d]: %s (SDO getReadResult error %d)\n",
-                      InternalError, nodeId, machine_state_index[nodeId],
-                      next_machine[nodeId][0]->error[1], sdo_result);
-                }
+          printf("ERR[%d on node %x state %d]: %s (SDO getReadResult error %d)\n", InternalError,
+              nodeId, context->step_index, machine_error_text(context), sdo_result);
+        }
 #endif
 
-                machine_state_index[nodeId]--; // provo a rieseguire la stessa funzione
-                machine_state_param_index[nodeId] -= 5;
-                break;
+        // provo a rieseguire la stessa lettura
+        return 2;
 
-              default:
+      default:
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  printf("ERR[%d on node %x state %d]: %s (SDO getReadResult error %d)\n",
-                      InternalError, nodeId, machine_state_index[nodeId],
-                      next_machine[nodeId][0]->error[1], sdo_result);
-                }
+        if(verbose_flag_state)
+        {
+          printf("ERR[%d on node %x state %d]: %s (SDO getReadResult error %d)\n", InternalError,
+              nodeId, context->step_index, machine_error_text(context), sdo_result);
+        }
 #endif
 
-                sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
+        sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
 #ifdef CANOPENSHELL_VERBOSE
-                if(verbose_flag_state)
-                {
-                  if((sdo_result != 0) && (sdo_result != 0xFF))
-                  {
-                    printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
-                        nodeId, machine_state_index[nodeId], next_machine[nodeId][0]->error[1],
-                        sdo_result);
-                  }
-                }
-#endif
-
-                result_value = 1;
-                goto finalize;
-                break;
-            }
+        if(verbose_flag_state)
+        {
+          if((sdo_result != 0) && (sdo_result != 0xFF))
+          {
+            printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError,
+                nodeId, context->step_index, machine_error_text(context), sdo_result);
           }
-          break;
-      } //switch(d->transfers[line].state)
+        }
+#endif
+        return 1;
     }
-    else
-      last_function = next_machine[nodeId][0]->function[0];
   }
 
-  next_machine_entry:
-  // Eseguo la prossima funzione
+  return 0;
+}
 
-// questa funzione non prevede un callback
-  if((machine_state_index[nodeId] < next_machine[nodeId][0]->function_size)
-      && (next_machine[nodeId][0]->function[machine_state_index[nodeId]]
-          == &masterSendNMTstateChange))
-  {
-    while(next_machine[nodeId][0]->function[machine_state_index[nodeId]]
-        == &masterSendNMTstateChange)
-    {
-      masterSendNMTstateChange_t machine_function =
-          next_machine[nodeId][0]->function[machine_state_index[nodeId]];
+/**
+ * Registra il tempo del trasferimento SDO appena concluso sul motore.
+ */
+static void machine_step_time(UNS8 nodeId, int error)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  struct timespec now;
+  long elapsed_us;
 
-      last_function = next_machine[nodeId][0]->function[machine_state_index[nodeId]];
+  clock_gettime(CLOCK_MONOTONIC, &now);
 
-      // chimao EnterMutex e LeaveMutex solo se non sono in un callback
-      if(!from_callback)
-      {
-        EnterMutex();
-      }
+  elapsed_us = (now.tv_sec - context->step_time.tv_sec) * 1000000
+      + (now.tv_nsec - context->step_time.tv_nsec) / 1000;
 
-      machine_function(d, nodeId,
-          next_machine[nodeId][0]->param[machine_state_param_index[nodeId]++]);
+  if(elapsed_us < 0)
+    elapsed_us = 0;
 
-      // chimao EnterMutex e LeaveMutex solo se non sono in un callback
-      if(!from_callback)
-      {
-        LeaveMutex();
-      }
+  sdo_stats_transfer(nodeId, context->step.index, elapsed_us, error);
+}
 
-      machine_state_index[nodeId]++;
+/**
+ * Alarm che invia di nuovo il passo in corso sul motore, alla fine
+ * dell'attesa decisa da machine_step_retry.
+ */
+static void machine_step_resend(CO_Data *d, UNS32 id)
+{
+  UNS8 nodeId = (UNS8) id;
 
-#ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag_state)
-      {
-        if(machine_state_index[nodeId] > next_machine[nodeId][0]->function_size)
-        {
-          printf("WARN[%d on node %x state %d]: Qualcuno uscito senza salutare...\n", InternalError,
-              nodeId, machine_state_index[nodeId]);
-        }
-      }
-#endif
+  machine_context[nodeId].timer = TIMER_NONE;
 
-      if(machine_state_index[nodeId] == next_machine[nodeId][0]->function_size)
-        break;
-    }
-  }
+  if(machine_context[nodeId].machine_count == 0)
+    return;
 
-  if(machine_state_index[nodeId] < next_machine[nodeId][0]->function_size)
-  {
-    if(next_machine[nodeId][0]->function[machine_state_index[nodeId]] == &writeNetworkDictCallBack)
-    {
-      writeNetworkDictCallBack_t machine_function =
-          next_machine[nodeId][0]->function[machine_state_index[nodeId]];
+  if(machine_step_start(d, nodeId, 1) < 0)
+    machine_send_error(d, nodeId, 1);
+}
 
-      UNS8 machine_function_return = 0;
+/**
+ * Ripete il passo in corso sul motore se restano tentativi, altrimenti chiude
+ * la sequenza con errore. Prima di ripetere il passo si attende
+ * MACHINE_SDO_BACKOFF_MS, raddoppiato ad ogni tentativo: nel frattempo la
+ * linea SDO passa agli altri motori, per cui un motore che non risponde
+ * rallenta solo le proprie sequenze.
+ *
+ * @remark: va chiamata con il mutex di CanFestival, dai callback SDO o dei
+ * timer.
+ */
+static void machine_step_retry(CO_Data *d, UNS8 nodeId)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  int attempts = context->step.attempts ? context->step.attempts : MACHINE_SDO_ATTEMPTS;
+  long backoff_ms;
 
-      UNS32 user_param[5];
+  machine_sdo_release(nodeId, 1);
 
-      for(i = 0; i < 5; i++)
-      {
-        // se il parametro è pari a 0xFFFFFFFF allora significa che devo prenderlo da quelli
-        // variabili
-        if(next_machine[nodeId][0]->param[machine_state_param_index[nodeId]] == 0xFFFFFFFF)
-        {
-          if(next_var_count[nodeId] < 1)
-          {
-            if(var_count_total[nodeId] == 0)
-              user_param[i] = next_machine[nodeId][0]->param[machine_state_param_index[nodeId]];
-            else
-            {
+  if(context->attempt >= attempts)
+  {
 #ifdef CANOPENSHELL_VERBOSE
-              if(verbose_flag_state)
-              {
-                printf("ERR[%d on node %x state %d]: %s (-1 insieme a parametri utente)\n",
-                    InternalError, nodeId, machine_state_index[nodeId],
-                    next_machine[nodeId][0]->error[1]);
-              }
+    if(verbose_flag_state)
+    {
+      printf("ERR[%d on node %x state %d]: %s (%d tentativi falliti)\n", InternalError, nodeId,
+          context->step_index, machine_error_text(context), context->attempt);
+    }
 #endif
 
-              result_value = 1;
-              goto finalize;
-            }
-          }
-          else
-          {
-            next_var_count[nodeId]--;
-
-            user_param[i] = *next_args[nodeId];
-            next_args[nodeId]++;
-          }
-        }
-        else
-          user_param[i] = next_machine[nodeId][0]->param[machine_state_param_index[nodeId]];
-
-        machine_state_param_index[nodeId]++;
-      }
+    machine_finalize(d, nodeId, 1, 1);
+    return;
+  }
 
-      if(nodeId != 0)
-      {
-        function_call_number[nodeId]++;
+  backoff_ms = MACHINE_SDO_BACKOFF_MS << (context->attempt - 1);
+  context->attempt++;
 
-        // delle volte vengono ricevuti degli SDO timeout. Lo sleep serve ad evitare
-        // il sovraccarico del bus dovuta ai molti messaggi. Non è un problema di banda,
-        // ma del numero di messaggi continui di tipo SDO che un motore può sostenere
-        //usleep(2000);
-        // chimao EnterMutex e LeaveMutex solo se non sono in un callback
-        if(!from_callback)
-          EnterMutex();
+  sdo_stats_retry(nodeId, context->step.index);
 
-        if(user_param[3] == visible_string)
-        {
-          machine_function_return = machine_function(d, nodeId, user_param[0], user_param[1],
-              user_param[2], user_param[3], (char *)user_param[4], _machine_callback, 0);
-        }
-        else
-        {
-          machine_function_return = machine_function(d, nodeId, user_param[0], user_param[1],
-              user_param[2], user_param[3], &user_param[4], _machine_callback, 0);
-        }
+  context->timer = SetAlarm(d, nodeId, machine_step_resend, MS_TO_TIMEVAL(backoff_ms), 0);
 
-        // chiamo EnterMutex e LeaveMutex solo se non sono in un callback
-        if(!from_callback)
-          LeaveMutex();
+  // senza timer liberi il passo viene ripetuto subito
+  if(context->timer == TIMER_NONE)
+    machine_step_resend(d, nodeId);
+}
 
-        if(machine_function_return != 0xFF)
-        {
-          machine_state_index[nodeId]++;
+/**
+ * Alarm del timeout della risposta al passo SDO in corso sul motore: il
+ * trasferimento viene chiuso ed il passo ripetuto o, finiti i tentativi, la
+ * sequenza viene chiusa con errore invece di lasciare il motore impegnato.
+ */
+static void machine_step_timeout(CO_Data *d, UNS32 id)
+{
+  UNS8 nodeId = (UNS8) id;
+  struct machine_context *context = &machine_context[nodeId];
+  int sdo_result;
 
-#ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag_state)
-          {
-            if(machine_state_index[nodeId] > next_machine[nodeId][0]->function_size)
-            {
-              printf("WARN[%d on node %x state %d]: Qualcuno uscito senza salutare...\n",
-                  InternalError, nodeId, machine_state_index[nodeId]);
-            }
+  context->timer = TIMER_NONE;
 
-            fflush(stdout);
-          }
-#endif
+  if(context->machine_count == 0)
+    return;
 
-          return 0;
-        }
-        else
-        {
 #ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag_state)
-          {
-            printf("ERR[%d on node %x state %d]: %s (writeNetwork error)\n", InternalError, nodeId,
-                machine_state_index[nodeId], next_machine[nodeId][0]->error[1]);
-          }
+  if(verbose_flag_state)
+  {
+    printf("ERR[%d on node %x state %d]: %s (SDO timeout, tentativo %d)\n", InternalError, nodeId,
+        context->step_index, machine_error_text(context), context->attempt);
+  }
 #endif
 
-          result_value = 1;
-          goto finalize;
-        }
-      }
-      else //if(nodeId != 0)
-      {
-        for(i = 1; i < CANOPEN_NODE_NUMBER; i++)
-        {
-#ifndef SDO_SYNC
-          lock_value = pthread_mutex_lock(&machine_mux[i]);
+  sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-          if((motor_active[i] > 0) && (machine_run[i] == 0))
-          {
-            machine_run[i] = 1;
-            lock_value = pthread_mutex_unlock(&machine_mux[i]);
-#else
-            if(motor_active[i] > 0)
-            {
-              lock_value = pthread_mutex_lock(&machine_mux);
-
-              if(machine_run == 1)
-                pthread_cond_wait(&machine_run_cond, &machine_mux);
-              else
-                machine_run = 1;
-
-              printf("writenetworkdick machine %d\n", nodeId);
-
-              lock_value = pthread_mutex_unlock(&machine_mux);
-            }
+#ifdef CANOPENSHELL_VERBOSE
+  if(verbose_flag_state)
+  {
+    if((sdo_result != 0) && (sdo_result != 0xFF))
+    {
+      printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError, nodeId,
+          context->step_index, machine_error_text(context), sdo_result);
+    }
+  }
 #endif
-            machine_state_param_index[i] = machine_state_param_index[nodeId];
-            function_call_number[i]++;
 
-            if(!from_callback)
-            {
-              EnterMutex();
-            }
+  machine_step_time(nodeId, 1);
+  sdo_stats_timeout(nodeId, context->step.index);
 
-            machine_function_return = machine_function(d, i, user_param[0], user_param[1],
-                user_param[2], user_param[3], &user_param[4], _machine_callback, 0);
-
-            if(!from_callback)
-            {
-              LeaveMutex();
-            }
+  machine_step_retry(d, nodeId);
+}
 
-            if(machine_function_return != 0xFF)
-            {
-              machine_state_index[i]++;
+/**
+ * Callback delle richieste SDO inviate dalla macchina a stati: raccoglie la
+ * risposta e prosegue con il passo successivo.
+ *
+ * @param d: puntatore al nodo canopen
+ * @param nodeID - ID del nodo da cui proviene la risposta
+ *
+ * @remark: In caso di errore, la macchina viene fermata e viene caricato il codice il relativo codice
+ * nella variabile globale canopen_abort_code.
+ */
+void _machine_callback(CO_Data* d, UNS8 nodeId)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  struct state_machine_struct *machine;
+  int step_result;
 
+  if(context->machine_count == 0)
+  {
 #ifdef CANOPENSHELL_VERBOSE
-              if(verbose_flag_state)
-              {
-                if(machine_state_index[i] > next_machine[i][0]->function_size)
-                {
-                  printf("WARN[%d on node %x state %d]: Qualcuno uscito senza salutare...\n",
-                      InternalError, nodeId, machine_state_index[i]);
-                }
-              }
-#endif
-            }
-            else
-            {
-#ifdef CANOPENSHELL_VERBOSE
-              if(verbose_flag_state)
-              {
-                printf("ERR[%d on node %x state %d]: %s (writeNetwork error)\n", InternalError, i,
-                    machine_state_index[i], next_machine[i][0]->error[1]);
-              }
-#endif
-              result_value = 1;
-              goto finalize;
-            }
-#ifndef SDO_SYNC
-          }
-          else
-            lock_value = pthread_mutex_unlock(&machine_mux[i]);
+    if(verbose_flag_state)
+    {
+      printf("ERR[%d on node %x state %d]: Errore al ritorno dal callback\n", InternalError,
+          nodeId, context->step_index);
+    }
 #endif
-        }
 
-        result_value = 0;
-        goto finalize;
-      }
-    }
-    else if(next_machine[nodeId][0]->function[machine_state_index[nodeId]]
-        == &readNetworkDictCallback)
-    {
-      readNetworkDictCallback_t machine_function =
-          next_machine[nodeId][0]->function[machine_state_index[nodeId]];
+    fflush(stdout);
+    return;
+  }
 
-      UNS8 machine_function_return = 0;
+  step_result = machine_step_result(d, nodeId);
 
-      UNS32 user_param[3];
+  // trasferimento concluso, anche con errore: il timeout non serve più
+  if(step_result >= 0)
+  {
+    if(context->timer != TIMER_NONE)
+    {
+      DelAlarm(context->timer);
+      context->timer = TIMER_NONE;
+    }
 
-      for(i = 0; i < 3; i++)
-      {
-        // se il parametro è pari a 0xFFFFFFFF allora significa che devo prenderlo da quelli
-        // variabili
-        if(next_machine[nodeId][0]->param[machine_state_param_index[nodeId]] == 0xFFFFFFFF)
-        {
-          if(next_var_count[nodeId] < 1)
-          {
-            if(var_count_total[nodeId] == 0)
-              user_param[i] = next_machine[nodeId][0]->param[machine_state_param_index[nodeId]];
-            else
-            {
-#ifdef CANOPENSHELL_VERBOSE
-              if(verbose_flag_state)
-              {
-                printf("ERR[%d on node %x state %d]: %s (-1 insieme a parametri utente)\n",
-                    InternalError, nodeId, machine_state_index[nodeId],
-                    next_machine[nodeId][0]->error[1]);
-              }
-#endif
+    machine_step_time(nodeId, step_result != 0);
+  }
 
-              result_value = 1;
-              goto finalize;
-            }
-          }
-          else
-          {
-            next_var_count[nodeId]--;
+  switch(step_result)
+  {
+    case -1:
+      return;
+
+    case 1:
+      machine_finalize(d, nodeId, 1, 1);
+      return;
+
+    case 2:
+      // il passo abortito viene ripetuto con gli stessi tentativi e le stesse
+      // attese del timeout, tornando in coda dietro agli altri motori
+      machine_step_retry(d, nodeId);
+      return;
+  }
 
-            user_param[i] = *next_args[nodeId];
-            next_args[nodeId]++;
-          }
-        }
-        else
-          user_param[i] = next_machine[nodeId][0]->param[machine_state_param_index[nodeId]];
+  // la linea passa al prossimo motore in coda prima che questo prosegua
+  machine_sdo_release(nodeId, 1);
 
-        machine_state_param_index[nodeId]++;
-      }
+  // il valore letto viene passato subito all'utente, a meno che non sia
+  // l'ultimo passo della sequenza: in quel caso lo riceve alla chiusura
+  machine = context->machine[context->machine_index];
 
-      if(nodeId != 0)
-      {
-        function_call_number[nodeId]++;
+  if(context->read_done && (context->callback != NULL)
+      && ((context->step_index != machine->step_count)
+          || (context->machine_index != context->machine_count - 1)))
+    context->callback(d, nodeId, context->step_index, 1, context->read_result);
 
-        // chimao EnterMutex e LeaveMutex solo se non sono in un callback
-        if(!from_callback)
-          EnterMutex();
+  machine_next(d, nodeId, 1);
+}
 
-        machine_function_return = machine_function(d, nodeId, user_param[0], user_param[1],
-            user_param[2], _machine_callback, 0);
+/**
+ * @return: la priorità più alta tra le macchine della sequenza
+ */
+static int machine_chain_priority(struct state_machine_struct *machine[], int callback_num)
+{
+  int priority = MACHINE_PRIORITY_NORMAL;
+  int i;
 
-        // chiamo EnterMutex e LeaveMutex solo se non sono in un callback
-        if(!from_callback)
-          LeaveMutex();
+  for(i = 0; i < callback_num; i++)
+  {
+    if(machine[i]->priority > priority)
+      priority = machine[i]->priority;
+  }
 
-        if(machine_function_return != 0xFF)
-        {
-          machine_state_index[nodeId]++;
+  return priority;
+}
 
-#ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag_state)
-          {
-            if(machine_state_index[nodeId] > next_machine[nodeId][0]->function_size)
-            {
-              printf("WARN[%d on node %x state %d]: Qualcuno uscito senza salutare...\n",
-                  InternalError, nodeId, machine_state_index[nodeId]);
-            }
+/**
+ * Prepara il contesto del motore per una nuova sequenza.
+ */
+static void machine_load(CO_Data *d, UNS8 nodeId, MachineCallback_t machine_callback,
+    struct state_machine_struct *machine[], int callback_num, int var_count, const uintptr_t *args)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  int i;
 
-            fflush(stdout);
-          }
-#endif
+  machine_context_clear(context);
 
-          return 0;
-        }
-        else
-        {
-          result_value = 1;
-          goto finalize;
-        }
-      }
-      else
-      {
-        for(i = 1; i < CANOPEN_NODE_NUMBER; i++)
-        {
-#ifndef SDO_SYNC
-          lock_value = pthread_mutex_lock(&machine_mux[i]);
+  for(i = 0; i < callback_num; i++)
+    context->machine[i] = machine[i];
 
-          if((motor_active[i] > 0) && machine_run[i] == 0)
-          {
-            machine_run[i] = 1;
+  context->priority = machine_chain_priority(machine, callback_num);
 
-            lock_value = pthread_mutex_unlock(&machine_mux[i]);
-#else
-            if(motor_active[i] > 0)
-            {
-              lock_value = pthread_mutex_lock(&machine_mux);
+  if(var_count > 0)
+    memcpy(context->args, args, var_count * sizeof(uintptr_t));
 
-              if(machine_run == 1)
-                pthread_cond_wait(&machine_run_cond, &machine_mux);
-              else
-                machine_run = 1;
+  context->machine_count = callback_num;
+  context->arg_count = var_count;
+  context->callback = machine_callback;
+  context->d = d;
+}
 
-              printf("writenetworkdick machine %d\n", nodeId);
+/**
+ * Avvia la prima richiesta in attesa, se il motore è libero.
+ */
+static void machine_queue_next(UNS8 nodeId, int from_callback)
+{
+  struct machine_queue *queue = &machine_queue[nodeId];
+  struct machine_request request;
+  int i;
 
-              lock_value = pthread_mutex_unlock(&machine_mux);
-#endif
-            machine_state_param_index[i] = machine_state_param_index[nodeId];
-            function_call_number[i]++;
+  // come in machine_submit, la richiesta si estrae e si carica sotto il mutex
+  // di CanFestival, preso prima di machine_mux
+  if(!from_callback)
+    EnterMutex();
 
-            if(!from_callback)
-              EnterMutex();
+  pthread_mutex_lock(&machine_mux[nodeId]);
 
-            machine_function_return = machine_function(d, i, user_param[0], user_param[1],
-                user_param[2], _machine_callback, 0);
+  if((machine_run[nodeId] == 1) || (queue->count == 0))
+  {
+    pthread_mutex_unlock(&machine_mux[nodeId]);
 
-            if(!from_callback)
-              LeaveMutex();
+    if(!from_callback)
+      LeaveMutex();
 
-            if(machine_function_return != 0xFF)
-              machine_state_index[i]++;
-          }
-#ifndef SDO_SYNC
-          else
-            lock_value = pthread_mutex_unlock(&machine_mux[i]);
-#endif
-        }
+    return;
+  }
 
-        result_value = 0;
-        goto finalize;
-      }
-    }
-    else
-    {
-#ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag_state)
-      {
-        printf("WARN[%d on node %x state %d]: Funzione utente inaspettata\n", InternalError, nodeId,
-            machine_state_index[nodeId]);
-      }
-#endif
+  request = queue->request[0];
 
-      CustomFunction_t machine_function =
-          next_machine[nodeId][0]->function[machine_state_index[nodeId]];
-      last_function = next_machine[nodeId][0]->function[machine_state_index[nodeId]];
+  for(i = 1; i < queue->count; i++)
+    queue->request[i - 1] = queue->request[i];
 
-      if(nodeId != 0)
-      {
-        machine_state_index[nodeId]++;
+  queue->count--;
+  machine_run[nodeId] = 1;
 
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag_state)
-        {
-          if(machine_state_index[nodeId] > next_machine[nodeId][0]->function_size)
-          {
-            printf("WARN[%d on node %x state %d]: Qualcuno uscito senza salutare...\n",
-                InternalError, nodeId, machine_state_index[nodeId]);
-          }
-        }
-#endif
+  pthread_mutex_unlock(&machine_mux[nodeId]);
 
-        function_call_number[nodeId]++;
+  machine_load(request.d, nodeId, request.callback, request.machine, request.machine_count,
+      request.arg_count, request.args);
 
-        machine_function(d, nodeId, next_machine[nodeId][0]->param,
-            next_machine[nodeId][0]->param_size);
+  machine_next(request.d, nodeId, 1);
 
-        fflush(stdout);
+  if(!from_callback)
+    LeaveMutex();
+}
 
-        return 0;
-      }
-      else
-      {
-        for(i = 1; i < CANOPEN_NODE_NUMBER; i++)
-        {
-          if(motor_active[i] > 0)
-          {
-            machine_state_index[i]++;
-            function_call_number[i]++;
+/**
+ * Interrompe la sequenza in corso sul motore, che resta impegnato per la
+ * richiesta che la sostituisce.
+ *
+ * @output callback: callback della sequenza interrotta, da chiamare con errore
+ * @output machine_state: passo a cui la sequenza è stata interrotta
+ *
+ * @remark: va chiamata con il mutex di CanFestival, perché la risposta al
+ * trasferimento chiuso non arrivi a _machine_callback.
+ */
+static void machine_abort(CO_Data *d, UNS8 nodeId, MachineCallback_t *callback,
+    int *machine_state)
+{
+  struct machine_context *context = &machine_context[nodeId];
+  int sdo_result;
 
-            machine_function(d, i, next_machine[i][0]->param, next_machine[i][0]->param_size);
-          }
-        }
+  *callback = context->callback;
+  *machine_state = context->step_index;
 
-        result_value = 0;
-        goto finalize;
-      }
-    }
+#ifdef CANOPENSHELL_VERBOSE
+  if(verbose_flag_state)
+  {
+    printf("ERR[%d on node %x state %d]: %s (Interrotta)\n", InternalError, nodeId,
+        context->step_index, machine_error_text(context));
   }
+#endif
+
+  sdo_result = closeSDOtransfer(d, nodeId, SDO_CLIENT);
 
-// Nel caso in cui le funzioni siano finite
-  if(machine_state_index[nodeId] == next_machine[nodeId][0]->function_size)
-  {
 #ifdef CANOPENSHELL_VERBOSE
-    if(verbose_flag)
+  if(verbose_flag_state)
+  {
+    if((sdo_result != 0) && (sdo_result != 0xFF))
     {
-      if(next_machine[nodeId][0]->error[0] != NULL)
-        printf("SUCC[node %x]: %s\n", nodeId, next_machine[nodeId][0]->error[0]);
+      printf("ERR[%d on node %x state %d]: %s (SDO close error %d)\n", InternalError, nodeId,
+          context->step_index, machine_error_text(context), sdo_result);
     }
+  }
 #endif
 
-    machine_state_param_index[nodeId] = 0;
+  machine_context_clear(context);
+  machine_sdo_release(nodeId, 1);
+}
+
+/**
+ * Avvia la sequenza sul motore o, se è occupato, la mette in attesa. Una
+ * sequenza con priorità più alta di quella in corso la interrompe e scarta le
+ * richieste in attesa con priorità più bassa: dopo una fermata non devono
+ * ripartire i movimenti chiesti prima.
+ *
+ * @return: 0 se la sequenza è stata avviata o messa in attesa, 1 in caso di
+ * errore
+ */
+static int machine_submit(CO_Data *d, UNS8 nodeId, MachineCallback_t machine_callback,
+    struct state_machine_struct *machine[], int callback_num, int from_callback, int var_count,
+    const uintptr_t *args)
+{
+  struct machine_queue *queue = &machine_queue[nodeId];
+  struct machine_request *request;
+  MachineCallback_t dropped[MACHINE_QUEUE_SIZE + 1];
+  int dropped_state = 0;
+  int dropped_count = 0;
+  int priority = machine_chain_priority(machine, callback_num);
+  int mutex_taken = 0;
+  int result_value = 0;
+  int i;
 
-    next_machine_size[nodeId]--;
+  // il contesto del motore si carica sotto il mutex di CanFestival, come nei
+  // callback: una fermata dal thread di CanFestival può interromperlo in ogni
+  // momento. Il mutex va preso prima di machine_mux
+  if(!from_callback)
+  {
+    EnterMutex();
+    mutex_taken = 1;
+    from_callback = 1;
+  }
 
-    // se è accodata un'altra macchina, allora l'avvio
-    if((next_machine[nodeId] != NULL) && (next_machine_size[nodeId] > 0))
-    {
-      machine_state_index[nodeId] = 0;
+  pthread_mutex_lock(&machine_mux[nodeId]);
 
-      for(i = 0; i < next_machine_size[nodeId]; i++)
-        next_machine[nodeId][i] = next_machine[nodeId][i + 1];
+  if(machine_run[nodeId] == 0)
+  {
+    machine_run[nodeId] = 1;
+    pthread_mutex_unlock(&machine_mux[nodeId]);
 
-      goto next_machine_entry;
-    }
-    else
-    {
-      result_value = 0;
-      goto finalize;
-    }
+    machine_load(d, nodeId, machine_callback, machine, callback_num, var_count, args);
+    result_value = machine_next(d, nodeId, from_callback);
   }
-#ifdef CANOPENSHELL_VERBOSE
-  else
+  else if(priority > machine_context[nodeId].priority)
   {
-    if(verbose_flag_state)
+    while((queue->count > 0) && (queue->request[queue->count - 1].priority < priority))
     {
-
-      printf("ERR[%d on node %x state %d]: Non dovresti essere arrivato qui...mmmh\n",
-          InternalError, nodeId, machine_state_index[nodeId]);
-      printf("Vediamo...\n Il numero di funzioni da eseguire era: %d. A quale sei arrivato?\n",
-          next_machine[nodeId][0]->function_size);
+      queue->count--;
+      dropped[dropped_count++] = queue->request[queue->count].callback;
     }
-  }
 
-  fflush(stdout);
-#endif
+    pthread_mutex_unlock(&machine_mux[nodeId]);
 
-  return 0;
+    // la sequenza interrotta viene chiamata per prima, ma la nuova è già nel
+    // contesto: un callback che richiede il motore finisce in attesa
+    machine_abort(d, nodeId, &dropped[dropped_count], &dropped_state);
+    machine_load(d, nodeId, machine_callback, machine, callback_num, var_count, args);
 
-  finalize:
-  // nel caso in cui la funzione broadcast chiudesse la macchina con una funzione che non
-  // prevedesse un callback, allora devo deallocare tutte le variabili precedenti.
-  if((machine_state_index[nodeId] == next_machine[nodeId][0]->function_size) && (nodeId == 0))
-  {
-    for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
+    if(dropped[dropped_count] != NULL)
+      dropped[dropped_count](d, nodeId, dropped_state, 0, 1);
+
+    for(i = 0; i < dropped_count; i++)
     {
+      if(dropped[i] != NULL)
+        dropped[i](d, nodeId, 0, 0, 1);
+    }
 
-      printf("Finalize %d\n", i);
-      if(motor_active[i] > 0)
-      {
-        next_machine_size[i] = 0;
-        next_var_count[i] = 0;
-        var_count_total[i] = 0;
-        machine_state_index[i] = 0;
-        machine_state_param_index[i] = 0;
+    result_value = machine_next(d, nodeId, from_callback);
+  }
+  else if(queue->count < MACHINE_QUEUE_SIZE)
+  {
+    // le richieste con la stessa priorità restano in ordine di arrivo
+    for(i = queue->count; (i > 0) && (queue->request[i - 1].priority < priority); i--)
+      queue->request[i] = queue->request[i - 1];
 
-        if(args_ptr[i] != NULL)
-        {
-          free(args_ptr[i]);
-          args_ptr[i] = NULL;
-          next_args[i] = NULL;
-        }
+    request = &queue->request[i];
 
-        if(next_machine[i] != NULL)
-        {
-          free(next_machine[i]);
-          next_machine[i] = NULL;
-        }
+    for(i = 0; i < callback_num; i++)
+      request->machine[i] = machine[i];
 
-#ifndef SDO_SYNC
-        // se c'è stato un errore, allora devo resettare tutte le variabili
-        // machine_run
-        if(result_value)
-        {
-          lock_value = pthread_mutex_lock(&machine_mux[i]);
-          machine_run[i] = 0;
-          lock_value = pthread_mutex_unlock(&machine_mux[i]);
-        }
+    if(var_count > 0)
+      memcpy(request->args, args, var_count * sizeof(uintptr_t));
 
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag_state)
-        {
-          if(lock_value != 0)
-            printf("ERR[%d on node %x state %d]: Impossibile sbloccare il mutex 6: %d\n",
-                InternalError, nodeId, machine_state_index[nodeId], lock_value);
-        }
-#endif
-#endif
-      }
-    }
+    request->machine_count = callback_num;
+    request->arg_count = var_count;
+    request->callback = machine_callback;
+    request->d = d;
+    request->priority = priority;
 
-#ifdef SDO_SYNC
-    lock_value = pthread_mutex_lock(&machine_mux);
-    machine_run = 0;
-    printf("end machine %d\n", nodeId);
-    pthread_cond_signal(&machine_run_cond);
-    lock_value = pthread_mutex_unlock(&machine_mux);
-#else
-    // se non ci sono stati problemi, posso considerare chiusa la
-    // richiesta broadcast
-    if(result_value == 0)
-      machine_run[0] = 0;
-#endif
+    queue->count++;
+
+    pthread_mutex_unlock(&machine_mux[nodeId]);
   }
   else
   {
-    int machine_index = machine_state_index[nodeId];
+    pthread_mutex_unlock(&machine_mux[nodeId]);
 
-    next_machine_size[nodeId] = 0;
-    next_var_count[nodeId] = 0;
-    var_count_total[nodeId] = 0;
-    machine_state_index[nodeId] = 0;
-    machine_state_param_index[nodeId] = 0;
-
-    if(args_ptr[nodeId] != NULL)
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag_state)
     {
-      free(args_ptr[nodeId]);
-      args_ptr[nodeId] = NULL;
-      next_args[nodeId] = NULL;
+      printf("ERR[%d on node %x state %d]: %s (Coda piena)\n", InternalError, nodeId,
+          machine_context[nodeId].step_index, machine[0]->error[1]);
     }
+#endif
+
+    fflush(stdout);
+
+    if(machine_callback != NULL)
+      machine_callback(d, nodeId, 0, 0, 1);
+
+    result_value = 1;
+  }
 
-    if(next_machine[nodeId] != NULL)
+  if(mutex_taken)
+    LeaveMutex();
+
+  return result_value;
+}
+
+/**
+ * Avvia una sequenza di macchine a stati sul motore.
+ *
+ * @param d: puntatore al nodo CanOpen.
+ * @param nodeId: ID del nodo con cui comunicare, 0 per tutti i motori attivi
+ * @param machine_callback: funzione chiamata alla fine della sequenza
+ * @param machine: macchine da eseguire in sequenza
+ * @param callback_num: numero di macchine, al massimo MACHINE_CHAIN_SIZE
+ * @param from_callback: indica se la funzione viene chiamata tramite un callback
+ * @param var_count: numero di argomenti, al massimo MACHINE_ARGS_SIZE
+ * @param args: argomenti da sostituire ai campi MACHINE_ARG_xxx dei passi,
+ * nell'ordine. Vengono copiati, per cui possono stare sullo stack del chiamante;
+ * delle stringhe (MACHINE_ARG_STRING) viene copiato solo il puntatore.
+ *
+ * @return: 0 se la sequenza è stata avviata o messa in attesa, 1 in caso di
+ * errore
+ *
+ * @remark: se il motore è occupato la sequenza aspetta, fino a
+ * MACHINE_QUEUE_SIZE richieste per motore, e parte appena termina quella in
+ * corso; le sequenze di fermata (MACHINE_PRIORITY_SAFETY) interrompono invece
+ * quella in corso. Le richieste broadcast avviano la stessa sequenza, con gli
+ * stessi argomenti, su ogni motore attivo.
+ */
+int _machine_exe(CO_Data *d, UNS8 nodeId, MachineCallback_t machine_callback,
+    struct state_machine_struct *machine[], int callback_num, int from_callback, int var_count,
+    const uintptr_t *args)
+{
+  int result_value = 0;
+  int i;
+
+  if((callback_num <= 0) || (callback_num > MACHINE_CHAIN_SIZE) || (var_count < 0)
+      || (var_count > MACHINE_ARGS_SIZE) || ((var_count > 0) && (args == NULL)))
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag_state)
     {
-      free(next_machine[nodeId]);
-      next_machine[nodeId] = NULL;
+      printf("ERR[%d on node %x]: Richiesta non valida (%d macchine, %d argomenti)\n",
+          InternalError, nodeId, callback_num, var_count);
     }
+#endif
+
+    if(machine_callback != NULL)
+      machine_callback(d, nodeId, 0, 0, 1);
 
-#ifndef SDO_SYNC
-    lock_value = pthread_mutex_lock(&machine_mux[nodeId]);
-    machine_run[nodeId] = 0;
-    lock_value = pthread_mutex_unlock(&machine_mux[nodeId]);
+    return 1;
+  }
+
+  if(nodeId != 0)
+    return machine_submit(d, nodeId, machine_callback, machine, callback_num, from_callback,
+        var_count, args);
 
+  // Controllo che sia attivo almeno un motore
+  if(motor_active_number == 0)
+  {
 #ifdef CANOPENSHELL_VERBOSE
     if(verbose_flag_state)
     {
-      if(lock_value != 0)
-        printf("ERR[%d on node %x state %d]: Impossibile sbloccare il mutex 7: %d\n", InternalError,
-            nodeId, machine_state_index[nodeId], lock_value);
+      printf("ERR[%d on node %x]: Nessun motore attivo\n", InternalError, nodeId);
     }
 #endif
-#else
-    lock_value = pthread_mutex_lock(&machine_mux);
-    machine_run = 0;
-    printf("end machine %d\n", nodeId);
-    pthread_cond_signal(&machine_run_cond);
-    lock_value = pthread_mutex_unlock(&machine_mux);
-#endif
 
-    // Call Callback function
-    if((callback_user[nodeId] != NULL) && (nodeId != 0))
+    if(machine_callback != NULL)
+      machine_callback(d, nodeId, 0, 0, 1);
+
+    return 1;
+  }
+
+  // ogni motore avvia la sequenza o la mette in attesa; i passi SDO vengono
+  // distribuiti dallo scheduler
+  for(i = 1; i < CANOPEN_NODE_NUMBER; i++)
+  {
+    if(motor_active[i] > 0)
     {
-      if(last_function == &readNetworkDictCallback)
-        callback_user[nodeId](d, nodeId, machine_index, 1, readNetworkDictCallback_result);
-      else
-        callback_user[nodeId](d, nodeId, machine_index, 0, result_value);
+      if(machine_submit(d, i, machine_callback, machine, callback_num, from_callback, var_count,
+          args))
+        result_value = 1;
     }
   }
 
-  fflush(stdout);
-
   return result_value;
 }
@@ -8,20 +8,63 @@
 #ifndef STATE_MACHINE_H_
 #define STATE_MACHINE_H_
 
+#include <stdint.h>
 #include "canfestival.h"
 
 #define CANOPEN_NODE_NUMBER 128 // 127 nodi più quello di broadcast
 #define SMART_TABLE_SIZE 45
-//#define SDO_SYNC // se impostato, la macchina a stati _machine_exe viene eseguita da un thread (motore)
-                 // per volta. Questo riduce il carico istantaneo sul bus, anche se aumenta il tempo
-                 // complessivo di esecuzione.
+
+#define MACHINE_CHAIN_SIZE 12 // macchine concatenabili in una richiesta (CT0 ne usa 10)
+#define MACHINE_ARGS_SIZE 128 // argomenti di una richiesta (CT0 ne usa 113)
+#define MACHINE_QUEUE_SIZE 4 // richieste in attesa per ogni motore, oltre a quella in esecuzione
+
+#define MACHINE_SDO_TIMEOUT_MS 1000 // attesa predefinita della risposta ad un passo SDO
+#define MACHINE_SDO_ATTEMPTS 3 // tentativi predefiniti di un passo SDO, compreso il primo
+#define MACHINE_SDO_BACKOFF_MS 50 // attesa prima di ripetere un passo, raddoppia ad ogni tentativo
+
+#define MACHINE_NMT 0 // cambio di stato NMT, il comando è in value
+#define MACHINE_SDO_WRITE 1
+#define MACHINE_SDO_READ 2
+
+// campi del passo presi dagli argomenti della richiesta, nell'ordine in cui
+// sono elencati
+#define MACHINE_ARG_INDEX 0x01
+#define MACHINE_ARG_SUBINDEX 0x02
+#define MACHINE_ARG_SIZE 0x04
+#define MACHINE_ARG_TYPE 0x08
+#define MACHINE_ARG_VALUE 0x10
+#define MACHINE_ARG_STRING 0x20 // la stringa non viene copiata: deve durare quanto la richiesta
+
+// priorità delle richieste SDO delle macchine a stati, vedi _machine_sdo_configure
+#define MACHINE_PRIORITY_NORMAL 0
+#define MACHINE_PRIORITY_SAFETY 1 // fermata ed emergenza, passano davanti alle altre richieste
+#define MACHINE_PRIORITY_COUNT 2
+
+#define MACHINE_STEP_COUNT(step) ((int) (sizeof(step) / sizeof((step)[0])))
+
+/**
+ * Passo di una macchina a stati.
+ */
+struct machine_step
+{
+  UNS8 operation; /**< MACHINE_xxx */
+  UNS16 index; /**< oggetto del dizionario */
+  UNS8 subindex;
+  UNS32 size; /**< byte da scrivere */
+  UNS8 type; /**< tipo CanFestival del dato, 0 oppure visible_string */
+  UNS32 value; /**< valore da scrivere o comando NMT */
+  UNS8 arg; /**< campi presi dagli argomenti della richiesta, MACHINE_ARG_xxx */
+  UNS16 timeout_ms; /**< attesa della risposta, 0 per MACHINE_SDO_TIMEOUT_MS */
+  UNS8 attempts; /**< tentativi dopo un timeout o un abort ricevuto dal motore, compreso il primo; 0 per MACHINE_SDO_ATTEMPTS */
+  const char *string; /**< stringa da scrivere per i passi visible_string */
+};
+
 struct state_machine_struct
 {
-  void **function;
-  int function_size;
-  UNS32 *param;
-  int param_size;
-  char **error;
+  const struct machine_step *step;
+  int step_count;
+  char *error[2]; /**< messaggio di successo (può essere NULL) e di errore */
+  int priority; /**< MACHINE_PRIORITY_xxx */
 };
 
 extern int motor_active[CANOPEN_NODE_NUMBER];
@@ -34,16 +77,6 @@ extern volatile UNS16 motor_status[CANOPEN_NODE_NUMBER];
 extern volatile UNS16 motor_statusword0[CANOPEN_NODE_NUMBER];
 extern UNS8 motor_mode[CANOPEN_NODE_NUMBER];
 
-extern void **sin_interpolation_function;
-extern UNS32 *sin_interpolation_param;
-
-extern struct state_machine_struct sin_interpolation_machine;
-
-extern void **sin_final_function;
-extern UNS32 *sin_final_param;
-
-extern struct state_machine_struct sin_final_machine;
-
 extern struct state_machine_struct smart_start_machine;
 extern struct state_machine_struct map1_pdo_machine;
 extern struct state_machine_struct map2_pdo_machine;
@@ -76,27 +109,16 @@ extern struct state_machine_struct gosub_machine;
 extern struct state_machine_struct smart_message_machine;
 extern struct state_machine_struct smart_set_mode_machine;
 
-typedef UNS8 (*writeNetworkDictCallBack_t)(CO_Data* d, UNS8 nodeId, UNS16 index,
-    UNS8 subIndex, UNS32 count, UNS8 dataType, void *data,
-    SDOCallback_t Callback, UNS8 useBlockMode);
-
-typedef UNS8 (*readNetworkDictCallback_t)(CO_Data* d, UNS8 nodeId, UNS16 index,
-    UNS8 subIndex, UNS8 dataType, SDOCallback_t Callback, UNS8 useBlockMode);
-
-typedef void (*masterSendNMTstateChange_t)(CO_Data* d, UNS8 Node_ID, UNS8 cs);
-
-typedef void (*CustomFunction_t)(CO_Data* d, UNS8 Node_ID, UNS32 *param_array,
-    UNS32 param_array_size);
-
 typedef void (*MachineCallback_t)(CO_Data* d, UNS8 Node_ID, int machine_state,
     int is_register, UNS32 return_value);
 
 void _machine_init();
 void _machine_destroy();
 void _machine_reset(CO_Data* d, UNS8 nodeId);
+int _machine_sdo_configure(int inflight_max);
 
 int _machine_exe(CO_Data *d, UNS8 nodeId, MachineCallback_t machine_callback,
     struct state_machine_struct *machine[], int callback_num, int from_callback,
-    int var_count, ...);
+    int var_count, const uintptr_t *args);
 
 #endif /* STATE_MACHINE_H_ */
@@ -8,7 +8,15 @@ C_SRCS += \
 ../CANOpenShellMasterError.c \
 ../CANOpenShellMasterOD.c \
 ../CANOpenShellStateMachine.c \
+../fifo_control.c \
 ../file_parser.c \
+../interp_feeder.c \
+../interp_pdo.c \
+../line_parser.c \
+../mot_index.c \
+../motb_file.c \
+../motion_limit.c \
+../sdo_stats.c \
 ../smartmotor_table.c \
 ../utils.c 
 
@@ -17,7 +25,15 @@ OBJS += \
 ./CANOpenShellMasterError.o \
 ./CANOpenShellMasterOD.o \
 ./CANOpenShellStateMachine.o \
+./fifo_control.o \
 ./file_parser.o \
+./interp_feeder.o \
+./interp_pdo.o \
+./line_parser.o \
+./mot_index.o \
+./motb_file.o \
+./motion_limit.o \
+./sdo_stats.o \
 ./smartmotor_table.o \
 ./utils.o 
 
@@ -26,7 +42,15 @@ C_DEPS += \
 ./CANOpenShellMasterError.d \
 ./CANOpenShellMasterOD.d \
 ./CANOpenShellStateMachine.d \
+./fifo_control.d \
 ./file_parser.d \
+./interp_feeder.d \
+./interp_pdo.d \
+./line_parser.d \
+./mot_index.d \
+./motb_file.d \
+./motion_limit.d \
+./sdo_stats.d \
 ./smartmotor_table.d \
 ./utils.d 
 
@@ -0,0 +1,416 @@
+/*
+ * fifo_control.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * La tabella veniva riempita solo alla ricezione dello stato dell'interpolatore,
+ * con tutti i posti che il motore dichiarava liberi. Con tempi brevi tra un
+ * punto e l'altro il motore consuma la FIFO prima che arrivi lo stato
+ * successivo e si svuota (CERR_InterpFIFOUnderError).
+ *
+ * Qui vengono ricordati i tempi dei punti inviati. Dallo stato del motore si
+ * ricava il livello della FIFO; tra uno stato e l'altro il livello viene stimato
+ * ad ogni SYNC togliendo i punti che il motore ha avuto il tempo di eseguire,
+ * e se scende sotto il livello desiderato i punti vengono inviati in anticipo.
+ *
+ * Lo stato è un TPDO sincrono: il motore campiona la FIFO al SYNC, mentre i
+ * punti anticipati partono subito dopo lo stesso SYNC e arrivano al motore
+ * prima dello stato. Per questo ogni punto viene registrato con il numero del
+ * SYNC dopo cui è stato trasmesso, e allo stato vengono dati per eseguiti solo
+ * i punti trasmessi prima del SYNC campionato; quelli successivi vengono
+ * aggiunti al livello dichiarato dal motore.
+ *
+ * La stima considera appena iniziato il punto in esecuzione all'ultimo stato,
+ * ed assume che lo stato arrivi prima del SYNC successivo a quello campionato.
+ * Resta scoperto il breve intervallo tra la trasmissione del SYNC e la chiamata
+ * a fifo_control_sync, eseguite di seguito dal thread di CanFestival: i punti
+ * trasmessi lì vengono contati come già presenti nello stato.
+ */
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "fifo_control.h"
+#include "CANOpenShellStateMachine.h"
+
+/**
+ * Stato del controllo per un motore.
+ */
+struct fifo_control_node
+{
+  int target; /**< livello di riempimento desiderato, 0 se predefinito */
+
+  unsigned short time_ms[FIFO_CONTROL_HISTORY]; /**< tempi dei punti che possono essere nella FIFO */
+  unsigned int time_sync[FIFO_CONTROL_HISTORY]; /**< SYNC dopo cui è stato trasmesso il punto */
+  unsigned int time_head; /**< punto più vecchio */
+  unsigned int time_tail; /**< dove scrivere il prossimo punto */
+
+  unsigned int sync_count; /**< SYNC trasmessi */
+
+  int status_level; /**< livello all'ultimo stato ricevuto */
+  int sent_since_status; /**< punti trasmessi dopo il SYNC campionato dall'ultimo stato */
+  unsigned int status_head; /**< time_head all'ultimo stato */
+  struct timespec status_time; /**< istante dell'ultimo stato */
+
+  unsigned long long level_sum; /**< somma dei livelli campionati */
+  unsigned long level_sample; /**< numero di campioni */
+  struct fifo_control_stats stats;
+
+  pthread_mutex_t mutex; /**< tra il thread CAN ed i comandi */
+};
+
+static struct fifo_control_node fifo_node[CANOPEN_NODE_NUMBER];
+static pthread_once_t fifo_once = PTHREAD_ONCE_INIT;
+
+static void fifo_mutex_init(void)
+{
+  int i;
+
+  for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
+    pthread_mutex_init(&fifo_node[i].mutex, NULL);
+}
+
+static struct fifo_control_node *fifo_node_lock(int nodeid)
+{
+  if((nodeid < 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return NULL;
+
+  pthread_once(&fifo_once, fifo_mutex_init);
+
+  pthread_mutex_lock(&fifo_node[nodeid].mutex);
+
+  return &fifo_node[nodeid];
+}
+
+static int fifo_target(const struct fifo_control_node *node)
+{
+  return (node->target == 0) ? FIFO_CONTROL_TARGET_DEFAULT : node->target;
+}
+
+/**
+ * Aggiorna le statistiche con un nuovo livello stimato.
+ */
+static void fifo_sample(struct fifo_control_node *node, int level)
+{
+  unsigned int i;
+
+  node->stats.level = level;
+
+  if((node->level_sample == 0) || (level < node->stats.level_min))
+    node->stats.level_min = level;
+
+  if((node->level_sample == 0) || (level > node->stats.level_max))
+    node->stats.level_max = level;
+
+  node->level_sum += level;
+  node->level_sample++;
+
+  // durata dei punti ancora da eseguire, dal più recente all'indietro
+  node->stats.buffered_ms = 0;
+
+  for(i = 0; (i < (unsigned int) level) && (i < node->time_tail - node->time_head); i++)
+    node->stats.buffered_ms += node->time_ms[(node->time_tail - 1 - i) & (FIFO_CONTROL_HISTORY - 1)];
+}
+
+/**
+ * Azzera lo stato e le statistiche del motore, da chiamare prima di avviare
+ * una nuova tabella. Il livello desiderato rimane quello impostato.
+ */
+void fifo_control_reset(int nodeid)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+  int target;
+
+  if(node == NULL)
+    return;
+
+  target = node->target;
+
+  node->time_head = 0;
+  node->time_tail = 0;
+  node->sync_count = 0;
+  node->status_level = 0;
+  node->sent_since_status = 0;
+  node->status_head = 0;
+  clock_gettime(CLOCK_MONOTONIC, &node->status_time);
+  node->level_sum = 0;
+  node->level_sample = 0;
+  memset(&node->stats, 0, sizeof(node->stats));
+  node->target = target;
+
+  pthread_mutex_unlock(&node->mutex);
+}
+
+/**
+ * Imposta il livello di riempimento desiderato.
+ *
+ * @input target: punti da tenere nella FIFO, tra 1 e FIFO_CONTROL_SIZE - 1
+ * (0 per il valore predefinito)
+ *
+ * @return:  0 -> livello impostato
+ *          -1 -> valore non valido
+ */
+int fifo_control_configure(int nodeid, int target)
+{
+  struct fifo_control_node *node;
+
+  if((target < 0) || (target > FIFO_CONTROL_SIZE - 1))
+    return -1;
+
+  node = fifo_node_lock(nodeid);
+
+  if(node == NULL)
+    return -1;
+
+  node->target = target;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return 0;
+}
+
+/**
+ * Registra lo stato ricevuto dal motore.
+ *
+ * @input free_slot: posti liberi dichiarati dal motore
+ * @input running: il motore sta eseguendo la tabella
+ *
+ * @return: numero di punti da inviare per portare la FIFO al livello desiderato
+ */
+int fifo_control_status(int nodeid, int free_slot, int running)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+  int level;
+  int sent_after_sync = 0;
+  int point_to_send;
+
+  if(node == NULL)
+    return 0;
+
+  level = FIFO_CONTROL_SIZE - free_slot;
+
+  if(level < 0)
+    level = 0;
+
+  // i punti trasmessi dopo il SYNC campionato non sono compresi nello stato
+  while(((unsigned int) sent_after_sync < node->time_tail - node->time_head)
+      && (node->time_sync[(node->time_tail - 1 - sent_after_sync) & (FIFO_CONTROL_HISTORY - 1)]
+          == node->sync_count))
+    sent_after_sync++;
+
+  // quelli trasmessi prima che non sono più nella FIFO sono stati eseguiti
+  while(node->time_tail - node->time_head - sent_after_sync > (unsigned int) level)
+    node->time_head++;
+
+  node->status_level = level;
+  node->sent_since_status = sent_after_sync;
+  node->status_head = node->time_head;
+  clock_gettime(CLOCK_MONOTONIC, &node->status_time);
+
+  if(running)
+    fifo_sample(node, level);
+
+  // un posto rimane sempre libero, come faceva il riempimento con i posti liberi
+  level += sent_after_sync;
+  point_to_send = fifo_target(node) - level;
+
+  if(point_to_send > FIFO_CONTROL_SIZE - 1 - level)
+    point_to_send = FIFO_CONTROL_SIZE - 1 - level;
+
+  if(point_to_send < 0)
+    point_to_send = 0;
+
+  if(point_to_send > 0)
+    node->stats.status_send_count++;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return point_to_send;
+}
+
+/**
+ * Stima il livello attuale della FIFO dall'ultimo stato e dai punti inviati
+ * dopo. Va chiamata con il mutex del motore.
+ *
+ * @input running: il motore sta eseguendo la tabella, altrimenti non consuma
+ * punti
+ */
+static int fifo_level(const struct fifo_control_node *node, int running)
+{
+  struct timespec now;
+  long elapsed_ms;
+  long consumed_ms = 0;
+  int consumed = 0;
+  unsigned int i;
+
+  if(running)
+  {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    elapsed_ms = (now.tv_sec - node->status_time.tv_sec) * 1000
+        + (now.tv_nsec - node->status_time.tv_nsec) / 1000000;
+
+    for(i = node->status_head; i != node->time_tail; i++)
+    {
+      consumed_ms += node->time_ms[i & (FIFO_CONTROL_HISTORY - 1)];
+
+      if(consumed_ms > elapsed_ms)
+        break;
+
+      consumed++;
+    }
+
+    if(consumed > node->status_level + node->sent_since_status)
+      consumed = node->status_level + node->sent_since_status;
+  }
+
+  return node->status_level - consumed + node->sent_since_status;
+}
+
+/**
+ * Registra il SYNC appena trasmesso e stima il livello della FIFO.
+ *
+ * @input running: il motore sta eseguendo la tabella
+ *
+ * @return: numero di punti da inviare in anticipo per riportare la FIFO al
+ * livello desiderato
+ *
+ * @remark: va chiamata ad ogni SYNC, anche con il motore fermo, prima di
+ * trasmettere altri punti.
+ */
+int fifo_control_sync(int nodeid, int running)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+  int level;
+  int point_to_send;
+
+  if(node == NULL)
+    return 0;
+
+  node->sync_count++;
+
+  if(!running)
+  {
+    pthread_mutex_unlock(&node->mutex);
+    return 0;
+  }
+
+  level = fifo_level(node, running);
+
+  fifo_sample(node, level);
+
+  point_to_send = fifo_target(node) - level;
+
+  if(point_to_send < 0)
+    point_to_send = 0;
+
+  if(point_to_send > 0)
+    node->stats.sync_send_count++;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return point_to_send;
+}
+
+/**
+ * Calcola quanti punti inviare adesso per portare la FIFO al livello
+ * desiderato, tenendo conto di tutti i punti già registrati con
+ * fifo_control_sent.
+ *
+ * @input running: il motore sta eseguendo la tabella
+ *
+ * @return: numero di punti da inviare
+ *
+ * @remark: va chiamata da chi invia i punti, subito prima dell'invio: i
+ * valori restituiti da fifo_control_status e fifo_control_sync valgono solo
+ * come segnalazione, perché nel frattempo possono essere partiti altri punti.
+ */
+int fifo_control_demand(int nodeid, int running)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+  int level;
+  int point_to_send;
+
+  if(node == NULL)
+    return 0;
+
+  level = fifo_level(node, running);
+
+  // un posto rimane sempre libero
+  point_to_send = fifo_target(node) - level;
+
+  if(point_to_send > FIFO_CONTROL_SIZE - 1 - level)
+    point_to_send = FIFO_CONTROL_SIZE - 1 - level;
+
+  if(point_to_send < 0)
+    point_to_send = 0;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return point_to_send;
+}
+
+/**
+ * Registra un punto inviato al motore.
+ *
+ * @remark: va chiamata dopo aver trasmesso il punto, così che il SYNC
+ * registrato non sia successivo alla trasmissione.
+ */
+void fifo_control_sent(int nodeid, long time_ms)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+
+  if(node == NULL)
+    return;
+
+  // la FIFO non contiene mai più di FIFO_CONTROL_SIZE punti
+  if(node->time_tail - node->time_head == FIFO_CONTROL_HISTORY)
+    node->time_head++;
+
+  if(node->status_head - node->time_head > node->time_tail - node->time_head)
+    node->status_head = node->time_head;
+
+  node->time_ms[node->time_tail & (FIFO_CONTROL_HISTORY - 1)] =
+      (time_ms > 0xFFFF) ? 0xFFFF : (unsigned short) time_ms;
+  node->time_sync[node->time_tail++ & (FIFO_CONTROL_HISTORY - 1)] = node->sync_count;
+  node->sent_since_status++;
+  node->stats.point_count++;
+
+  pthread_mutex_unlock(&node->mutex);
+}
+
+/**
+ * Registra uno svuotamento della FIFO segnalato dal motore.
+ */
+void fifo_control_underflow(int nodeid)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+
+  if(node == NULL)
+    return;
+
+  node->stats.underflow_count++;
+
+  pthread_mutex_unlock(&node->mutex);
+}
+
+/**
+ * Restituisce le statistiche della FIFO del motore.
+ *
+ * @return:  0 -> statistiche valide
+ *          -1 -> indirizzo non valido
+ */
+int fifo_control_stats_get(int nodeid, struct fifo_control_stats *stats)
+{
+  struct fifo_control_node *node = fifo_node_lock(nodeid);
+
+  if(node == NULL)
+    return -1;
+
+  *stats = node->stats;
+  stats->target = fifo_target(node);
+  stats->level_mean = (node->level_sample > 0) ? (int) (node->level_sum / node->level_sample) : 0;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * fifo_control.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Controllo del livello di riempimento della FIFO dell'interpolatore SmartMotor.
+ */
+
+#ifndef FIFO_CONTROL_H_
+#define FIFO_CONTROL_H_
+
+#define FIFO_CONTROL_SIZE 45 // posti della FIFO dell'interpolatore SmartMotor
+#define FIFO_CONTROL_TARGET_DEFAULT (FIFO_CONTROL_SIZE - 1) // equivale a riempire tutti i posti liberi meno uno
+#define FIFO_CONTROL_HISTORY 64 // tempi dei punti ricordati, potenza di 2 maggiore di FIFO_CONTROL_SIZE
+
+/**
+ * Statistiche sul livello della FIFO di un motore, dall'ultimo avvio della
+ * simulazione.
+ */
+struct fifo_control_stats
+{
+  int target; /**< livello di riempimento desiderato */
+  int level; /**< ultimo livello stimato */
+  int level_min; /**< livello minimo stimato */
+  int level_max; /**< livello massimo stimato */
+  int level_mean; /**< livello medio stimato */
+  long buffered_ms; /**< durata dei punti stimati nella FIFO */
+  unsigned long underflow_count; /**< svuotamenti segnalati dal motore */
+  unsigned long status_send_count; /**< invii fatti alla ricezione dello stato */
+  unsigned long sync_send_count; /**< invii anticipati fatti al SYNC */
+  unsigned long point_count; /**< punti inviati */
+};
+
+void fifo_control_reset(int nodeid);
+int fifo_control_configure(int nodeid, int target);
+int fifo_control_status(int nodeid, int free_slot, int running);
+int fifo_control_sync(int nodeid, int running);
+int fifo_control_demand(int nodeid, int running);
+void fifo_control_sent(int nodeid, long time_ms);
+void fifo_control_underflow(int nodeid);
+int fifo_control_stats_get(int nodeid, struct fifo_control_stats *stats);
+
+#endif /* FIFO_CONTROL_H_ */
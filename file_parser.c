@@ -8,7 +8,8 @@
  * in cui raggiungerli. Sarà cura del modulo di conversione rpy-punti effettuare
  * tutti i controlli per quanto riguarda sia le velocità massime raggiunte,
  * il rispetto dei tempi minimi e che la somma di tutti i tempi per ogni motore
- * sia uguale rispetto a tutti gli altri.
+ * sia uguale rispetto a tutti gli altri. La sintassi e la durata totale
+ * vengono comunque ricontrollate da FileValidate prima di avviare la simulazione.
  * La directory di default dove trovare i file sarà ./table
  */
 #include <stdio.h>
@@ -18,8 +19,15 @@
 #include <unistd.h>
 #include <errno.h>
 #include <ctype.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "CANOpenShellMasterError.h"
 #include "file_parser.h"
+#include "line_parser.h"
+#include "motb_file.h"
+#include "mot_index.h"
 #include "CANOpenShell.h"
 
 long row_read[127];
@@ -27,6 +35,8 @@ long row_total[127];
 float compleate_percent;
 
 int QueuePutPositionPipe(struct table_data *data);
+int QueuePutMap(struct table_data *data, int line_number);
+int QueuePutBinary(struct table_data *data, int line_number);
 
 float FileCompleteGet(int nodeId, int point_in_table)
 {
@@ -39,23 +49,51 @@ float FileCompleteGet(int nodeId, int point_in_table)
     return 0;
 }
 
-long FileLineCount(int nodeId)
+/**
+ * Legge l'indice del file tabella del motore, da liberare con MotIndexFree.
+ *
+ * @remark: l'indice viene costruito solo se manca o se il file è cambiato
+ * (vedi mot_index.c).
+ */
+static int FileIndexLoad(int nodeId, struct mot_index *index)
 {
-  FILE *file = NULL;
-  char *line = NULL;
-  size_t len = 0;
-
   char file_path[256];
-  long line_count = 0;
 
   if(fake_flag == 0)
     sprintf(file_path, "%s%d.mot", FILE_DIR, nodeId);
   else
     sprintf(file_path, "%s%d.mot.fake", FILE_DIR, nodeId);
 
-  file = fopen(file_path, "r");
+  return MotIndexGet(file_path, nodeId, index);
+}
+
+/**
+ * Legge l'intestazione dell'indice del file tabella del motore.
+ */
+static int FileIndexGet(int nodeId, struct mot_index_header *header)
+{
+  struct mot_index index;
+
+  if(FileIndexLoad(nodeId, &index) < 0)
+    return -1;
+
+  MotIndexFree(&index);
+  memcpy(header, &index.header, sizeof(index.header));
+
+  return 0;
+}
+
+/**
+ * Restituisce il numero di righe del file tabella del motore.
+ *
+ * @remark: il numero di righe viene preso dall'indice del file, quindi
+ * l'avvio della simulazione non dipende dalla lunghezza della tabella.
+ */
+long FileLineCount(int nodeId)
+{
+  struct mot_index_header header;
 
-  if(file == NULL)
+  if(FileIndexGet(nodeId, &header) < 0)
   {
 #ifdef CANOPENSHELL_VERBOSE
     if(verbose_flag)
@@ -64,14 +102,139 @@ long FileLineCount(int nodeId)
     return -1;
   }
 
-  // Ogni informazione è delimitata da uno spazio
-  while(getline(&line, &len, file) != -1)
-    line_count++;
+  return header.line_count;
+}
 
-  free(line);
-  fclose(file);
+static void *FileIndexBuilder(void *args)
+{
+  FileLineCount((long) args);
 
-  return line_count;
+  return NULL;
+}
+
+/**
+ * Prepara in background l'indice del file tabella del motore.
+ *
+ * @remark: viene chiamata quando si caricano i parametri di homing, così
+ * l'eventuale ricostruzione dell'indice avviene durante la ricerca del centro
+ * e non all'avvio della simulazione.
+ */
+void FileIndexPrepare(int nodeId)
+{
+  pthread_t index_builder;
+
+  if(pthread_create(&index_builder, NULL, FileIndexBuilder, (void *) (long) nodeId) == 0)
+    pthread_detach(index_builder);
+}
+
+struct file_validation
+{
+  int nodeId;
+  int result;
+  pthread_t validator;
+  struct mot_index_header header;
+};
+
+static void *FileValidator(void *args)
+{
+  struct file_validation *validation = args;
+
+  validation->result = FileIndexGet(validation->nodeId, &validation->header);
+
+  return NULL;
+}
+
+/**
+ * Controlla i file tabella di tutti i motori prima della simulazione.
+ *
+ * @input data: tabelle dei motori
+ * @input table_num: numero di tabelle da controllare
+ * @output total_time_ms: durata della simulazione (può essere NULL)
+ *
+ * @return: 0 se tutti i file sono corretti, -1 altrimenti
+ *
+ * @remark: ogni file viene letto da un thread diverso. Oltre alla sintassi di
+ * ogni riga ed all'indirizzo del motore, viene verificato che la somma dei tempi
+ * sia la stessa per tutti i motori. Per ogni file non valido viene aggiunto un
+ * evento CERR_FileError, in modo da avere un unico resoconto per tutti i motori.
+ * Il risultato viene salvato nell'indice del file, quindi un file non modificato
+ * non viene letto di nuovo.
+ */
+int FileValidate(struct table_data *data, int table_num, unsigned long *total_time_ms)
+{
+  struct file_validation validation[TABLE_MAX_NUM];
+  char event_text[100];
+  int reference = -1;
+  int error = 0;
+  int i;
+
+  if(table_num > TABLE_MAX_NUM)
+    table_num = TABLE_MAX_NUM;
+
+  for(i = 0; i < table_num; i++)
+  {
+    validation[i].nodeId = data[i].nodeId;
+
+    if(pthread_create(&validation[i].validator, NULL, FileValidator, &validation[i]) != 0)
+    {
+      validation[i].validator = 0;
+      FileValidator(&validation[i]);
+    }
+  }
+
+  for(i = 0; i < table_num; i++)
+  {
+    if(validation[i].validator != 0)
+      pthread_join(validation[i].validator, NULL);
+
+    if(validation[i].result < 0)
+    {
+      add_event(CERR_FileError, validation[i].nodeId, 0, "file non trovato");
+      error++;
+      continue;
+    }
+
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+    {
+      printf("INF[%d on node %x]: %u punti, durata %llu ms, %u righe non valide\n", InternalError,
+          validation[i].nodeId, validation[i].header.point_count,
+          (unsigned long long) validation[i].header.total_time_ms,
+          validation[i].header.error_count);
+    }
+#endif
+
+    if(validation[i].header.error_count > 0)
+    {
+      sprintf(event_text, "linea %u colonna %u (%u righe non valide)",
+          validation[i].header.error_line, validation[i].header.error_column,
+          validation[i].header.error_count);
+      add_event(CERR_FileError, validation[i].nodeId, 0, event_text);
+      error++;
+    }
+    else if(reference < 0)
+      reference = i;
+    else if(validation[i].header.total_time_ms != validation[reference].header.total_time_ms)
+    {
+      sprintf(event_text, "durata %llu ms diversa da M%d (%llu ms)",
+          (unsigned long long) validation[i].header.total_time_ms, validation[reference].nodeId,
+          (unsigned long long) validation[reference].header.total_time_ms);
+      add_event(CERR_FileError, validation[i].nodeId, 0, event_text);
+      error++;
+    }
+  }
+
+  if((total_time_ms != NULL) && (reference >= 0))
+    *total_time_ms = validation[reference].header.total_time_ms;
+
+  return (error == 0) ? 0 : -1;
+}
+
+static void QueueRefillerUnlock(void *args)
+{
+  struct table_data *data = args;
+
+  pthread_mutex_unlock(&data->table_mutex);
 }
 
 void *QueueRefiller(void *args)
@@ -80,6 +243,11 @@ void *QueueRefiller(void *args)
   int data_refilled = 0;
   int err;
 
+  struct timespec refill_start;
+  struct timespec refill_stop;
+  long parsed_lines = 0;
+  double parse_time = 0;
+
   if(data->is_pipe)
   {
     if(QueueOpenFile(data) < 0)
@@ -101,21 +269,56 @@ void *QueueRefiller(void *args)
   if(err != 0)
     printf("can't set thread as cancellable deferred\n");
 
-  if(data->is_pipe == 0)
-    row_total[data->nodeId] = FileLineCount(data->nodeId);
+  // se è presente il file compilato aggiornato, lo preferisco a quello di testo
+  if((data->is_pipe == 0) && (QueueOpenBinary(data) < 0))
+  {
+    if((mmap_flag == 0) || (QueueMapFile(data) == 0))
+      row_total[data->nodeId] = FileLineCount(data->nodeId);
+    else
+      row_total[data->nodeId] = -1;
+  }
 
   data->end_reached = 0;
 
+  // la simulazione può ripartire da un istante diverso dall'inizio
+  if((data->is_pipe == 0) && (data->start_time_ms > 0) && (QueueSeekTime(data) < 0))
+  {
+    printf("ERR[%d on node %x]: impossibile iniziare da %ld ms\n", InternalError, data->nodeId,
+        data->start_time_ms);
+
+    QueueCloseFile(data);
+    data->end_reached = 1;
+    data->table_refiller = 0;
+
+    return NULL;
+  }
+
   while(1)
   {
     pthread_testcancel();
 
     if(data->is_pipe == 0)
     {
-      if(data->count < POSITION_DATA_NUM_MAX)
-        data_refilled = QueuePut(data, POSITION_DATA_NUM_MAX - data->count);
-      else
-        goto go_sleep;
+      // la coda è sopra la soglia minima: attendo che QueueUpdate mi risvegli
+      // invece di controllarla periodicamente
+      pthread_mutex_lock(&data->table_mutex);
+      pthread_cleanup_push(QueueRefillerUnlock, data);
+
+      while((QueueCount(data) >= data->low_watermark) && (data->end_reached == 0))
+        pthread_cond_wait(&data->table_refill, &data->table_mutex);
+
+      pthread_cleanup_pop(1);
+
+      clock_gettime(CLOCK_MONOTONIC, &refill_start);
+      data_refilled = QueuePut(data, data->high_watermark - QueueCount(data));
+      clock_gettime(CLOCK_MONOTONIC, &refill_stop);
+
+      if(data_refilled > 0)
+      {
+        parsed_lines += data_refilled;
+        parse_time += (refill_stop.tv_sec - refill_start.tv_sec)
+            + (refill_stop.tv_nsec - refill_start.tv_nsec) / 1e9;
+      }
     }
     else
       data_refilled = QueuePutPositionPipe(data);
@@ -136,16 +339,31 @@ void *QueueRefiller(void *args)
     {
       break;
     }
+  }
 
-    go_sleep: if(data->is_pipe == 0)
-      usleep(10000);
+#ifdef CANOPENSHELL_VERBOSE
+  // velocità di lettura della tabella, esclusi i tempi di attesa tra le ricariche
+  if(verbose_flag && (parse_time > 0))
+  {
+    printf("INF[%d on node %x]: lette %ld righe in %.3f ms (%.2f Mrighe/s)\n", InternalError,
+        data->nodeId, parsed_lines, parse_time * 1000, parsed_lines / parse_time / 1e6);
   }
+#endif
 
   data->table_refiller = 0;
 
   return NULL;
 }
 
+/**
+ * Apre il file delle posizioni associato alla tabella.
+ *
+ * @remark: per la pipe viene aperto il file di posizione, per la tabella il file
+ * di simulazione. Nel secondo caso il file resta aperto fino alla fine della
+ * lettura e viene associato un buffer di lettura di dimensioni maggiori del
+ * default: in questo modo ogni ricarica legge solo i dati che le servono, senza
+ * dover riaprire il file e riposizionare il cursore.
+ */
 int QueueOpenFile(struct table_data *data)
 {
   char file_path[256];
@@ -153,6 +371,8 @@ int QueueOpenFile(struct table_data *data)
   {
     if(fake_flag == 0)
       sprintf(file_path, "%s%d.mot", FILE_DIR, data->nodeId);
+    else if(data->is_pipe == 0)
+      sprintf(file_path, "%s%d.mot.fake", FILE_DIR, data->nodeId);
     else
 #ifdef CBRN
       sprintf(file_path, "%s%d.mot.cbrn", FILE_DIR, data->nodeId);
@@ -170,12 +390,210 @@ int QueueOpenFile(struct table_data *data)
 #endif
       return -1;
     }
+
+    if(data->is_pipe == 0)
+    {
+      data->position_file_buffer = malloc(POSITION_FILE_BUFFER_SIZE);
+
+      if(data->position_file_buffer != NULL)
+        setvbuf(data->position_file, data->position_file_buffer, _IOFBF,
+            POSITION_FILE_BUFFER_SIZE);
+    }
+
+    data->cursor_position = 0;
+  }
+
+  return 0;
+}
+
+/**
+ * Mappa in memoria il file della tabella.
+ *
+ * @remark: la mappatura viene fatta una sola volta e resta valida fino alla
+ * chiusura del file; cursor_position indica lo spostamento all'interno della
+ * mappatura. Un file vuoto non viene mappato e risulta subito terminato.
+ */
+int QueueMapFile(struct table_data *data)
+{
+  char file_path[256];
+  struct stat file_stat;
+  void *map;
+  int fd;
+
+  if(data->position_map != NULL)
+    return 0;
+
+  if(fake_flag == 0)
+    sprintf(file_path, "%s%d.mot", FILE_DIR, data->nodeId);
+  else
+    sprintf(file_path, "%s%d.mot.fake", FILE_DIR, data->nodeId);
+
+  fd = open(file_path, O_RDONLY);
+
+  if(fd < 0)
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+      perror("file");
+#endif
+    return -1;
+  }
+
+  if(fstat(fd, &file_stat) < 0)
+  {
+    close(fd);
+    return -1;
+  }
+
+  data->cursor_position = 0;
+  data->position_map_size = file_stat.st_size;
+
+  if(data->position_map_size == 0)
+  {
+    close(fd);
+    return 0;
+  }
+
+  map = mmap(NULL, data->position_map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // il descrittore non serve più: la mappatura resta valida
+  close(fd);
+
+  if(map == MAP_FAILED)
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+      perror("mmap");
+#endif
+    data->position_map_size = 0;
+    return -1;
+  }
+
+  madvise(map, data->position_map_size, MADV_SEQUENTIAL);
+
+  data->position_map = map;
+
+  return 0;
+}
+
+/**
+ * Apre il file compilato .motb della tabella, se presente e valido.
+ *
+ * @return: 0 se il file è stato aperto, -1 se si deve usare il file di testo
+ *
+ * @remark: il file compilato viene usato solo se non è più vecchio del
+ * file di testo da cui deriva, in modo da non eseguire mai una tabella superata.
+ */
+int QueueOpenBinary(struct table_data *data)
+{
+  char file_path[256];
+  char binary_path[256];
+  struct stat file_stat;
+  struct stat binary_stat;
+  struct motb_header header;
+  int header_result;
+
+  if(data->is_binary)
+    return 0;
+
+  if(fake_flag == 0)
+  {
+    sprintf(file_path, "%s%d.mot", FILE_DIR, data->nodeId);
+    sprintf(binary_path, "%s%d%s", FILE_DIR, data->nodeId, MOTB_EXTENSION);
+  }
+  else
+  {
+    sprintf(file_path, "%s%d.mot.fake", FILE_DIR, data->nodeId);
+    sprintf(binary_path, "%s%d%s.fake", FILE_DIR, data->nodeId, MOTB_EXTENSION);
+  }
+
+  if(stat(binary_path, &binary_stat) != 0)
+    return -1;
+
+  if((stat(file_path, &file_stat) == 0) && (file_stat.st_mtime > binary_stat.st_mtime))
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+      printf("WARN[%d on node %x]: %s più vecchio del file di testo\n", InternalError,
+          data->nodeId, binary_path);
+#endif
+    return -1;
+  }
+
+  QueueCloseFile(data);
+
+  data->position_file = fopen(binary_path, "r");
+
+  if(data->position_file == NULL)
+    return -1;
+
+  header_result = MotbHeaderRead(data->position_file, data->nodeId, &header);
+
+  if(header_result < 0)
+  {
+#ifdef CANOPENSHELL_VERBOSE
+    if(verbose_flag)
+      printf("WARN[%d on node %x]: %s non valido (%d)\n", InternalError, data->nodeId,
+          binary_path, header_result);
+#endif
+    QueueCloseFile(data);
+    return -1;
   }
 
+  data->position_file_buffer = malloc(POSITION_FILE_BUFFER_SIZE);
+
+  if(data->position_file_buffer != NULL)
+    setvbuf(data->position_file, data->position_file_buffer, _IOFBF, POSITION_FILE_BUFFER_SIZE);
+
+  data->cursor_position = 0;
+  data->is_binary = 1;
+
+  row_total[data->nodeId] = header.point_count;
+
   return 0;
 }
 
-void QueueInit(int nodeid, struct table_data *data)
+/**
+ * Chiude il file delle posizioni e libera il buffer di lettura.
+ */
+void QueueCloseFile(struct table_data *data)
+{
+  if(data->position_map != NULL)
+  {
+    munmap(data->position_map, data->position_map_size);
+    data->position_map = NULL;
+  }
+
+  data->position_map_size = 0;
+
+  if(data->position_file != NULL)
+  {
+    fclose(data->position_file);
+    data->position_file = NULL;
+  }
+
+  if(data->position_file_buffer != NULL)
+  {
+    free(data->position_file_buffer);
+    data->position_file_buffer = NULL;
+  }
+
+  if(data->line_buffer != NULL)
+  {
+    free(data->line_buffer);
+    data->line_buffer = NULL;
+    data->line_buffer_size = 0;
+  }
+}
+
+/**
+ * Azzera la coda del motore, fermando il riempitore, ed alloca il buffer
+ * circolare con le dimensioni impostate da QueueConfigure.
+ *
+ * @return: 0 -> successo
+ *         -1 -> memoria insufficiente per il buffer circolare
+ */
+int QueueInit(int nodeid, struct table_data *data)
 {
   void *res;
 
@@ -191,46 +609,135 @@ void QueueInit(int nodeid, struct table_data *data)
     }
   }
 
-  if(data->position_file != NULL)
-  {
-    fclose(data->position_file);
-    data->position_file = NULL;
-  }
+  QueueCloseFile(data);
 
   data->nodeId = nodeid;
   data->write_pointer = 0;
   data->read_pointer = 0;
-  data->count = 0;
+  data->position_update = 0;
+  data->position_start = 0;
   data->cursor_position = 0;
   data->end_reached = 0;
   data->is_pipe = 0;
+  data->is_binary = 0;
+  data->start_time_ms = 0;
+  MotbTimeEncoderReset(&data->time_encoder);
+
+  // le dimensioni richieste con QueueConfigure vengono applicate qui, quando
+  // il riempitore è sicuramente fermo
+  if(data->config.capacity == 0)
+    QueueConfigure(data, 0, 0, 0);
+
+  if((data->point == NULL) || (data->capacity != data->config.capacity))
+  {
+    free(data->point);
+    data->capacity = 0;
+    data->mask = 0;
+
+    if(posix_memalign((void **) &data->point, CACHE_LINE_SIZE,
+        data->config.capacity * sizeof(data->point[0])) == 0)
+    {
+      data->capacity = data->config.capacity;
+      data->mask = data->capacity - 1;
+    }
+    else
+    {
+      data->point = NULL;
+      printf("ERR[%d on node %x]: memoria insufficiente per %u punti\n", InternalError, nodeid,
+          data->config.capacity);
+    }
+  }
+
+  data->high_watermark = data->config.high_watermark;
+  data->low_watermark = data->config.low_watermark;
+
+  if(data->high_watermark > data->capacity)
+    data->high_watermark = data->capacity;
+
+  if(data->low_watermark > data->high_watermark)
+    data->low_watermark = data->high_watermark;
 
   row_read[nodeid] = 0;
 
+  if(data->point == NULL)
+    return -1;
+
+  return 0;
 }
 
+/**
+ * Imposta le dimensioni del buffer circolare del motore.
+ *
+ * @input capacity: numero di punti, potenza di 2 (0 per il valore predefinito)
+ * @input low_watermark: sotto questo numero di punti il riempitore viene
+ *                       risvegliato (0 per metà di high_watermark)
+ * @input high_watermark: il riempitore riempie la coda fino a questo numero di
+ *                        punti (0 per riempirla tutta)
+ *
+ * @return: 0 se i valori sono stati accettati, -1 altrimenti
+ *
+ * @remark: i nuovi valori vengono applicati dal successivo QueueInit, quindi al
+ * prossimo avvio della simulazione. Tabelle con punti ogni 2 ms possono avere
+ * buffer profondi, mentre quelle con punti radi non sprecano memoria.
+ */
+int QueueConfigure(struct table_data *data, unsigned int capacity, int low_watermark,
+    int high_watermark)
+{
+  if(capacity == 0)
+    capacity = POSITION_DATA_NUM_MAX;
+
+  if((capacity < POSITION_DATA_NUM_MIN) || (capacity > POSITION_DATA_NUM_LIMIT)
+      || ((capacity & (capacity - 1)) != 0))
+    return -1;
+
+  if(high_watermark == 0)
+    high_watermark = capacity;
+
+  if(low_watermark == 0)
+    low_watermark = high_watermark / 2;
+
+  if((high_watermark < 0) || (high_watermark > capacity) || (low_watermark < 1)
+      || (low_watermark > high_watermark))
+    return -1;
+
+  data->config.capacity = capacity;
+  data->config.low_watermark = low_watermark;
+  data->config.high_watermark = high_watermark;
+
+  return 0;
+}
+
+/**
+ * Riporta la coda all'inizio della tabella ed avvia il riempitore.
+ *
+ * @return: 0 -> successo
+ *         -1 -> buffer circolare non allocato (vedi QueueInit) o riempitore non
+ *               avviato
+ */
 int QueueFill(struct table_data *data)
 {
+  // senza buffer il riempitore non caricherebbe mai punti
+  if(data->point == NULL)
+    return -1;
+
   row_read[data->nodeId] = 0;
 
   pthread_mutex_lock(&data->table_mutex);
 
-  data->write_pointer = 0;
-  data->read_pointer = 0;
-  data->count = 0;
+  __atomic_store_n(&data->write_pointer, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&data->read_pointer, 0, __ATOMIC_RELEASE);
   data->cursor_position = 0;
   data->end_reached = 0;
 
   pthread_mutex_unlock(&data->table_mutex);
 
-  /*if(data->is_pipe == 0)
+  // la tabella riparte dall'inizio del file: se il file era già stato aperto
+  // (ad esempio per leggere la riga di homing) lo richiudo
+  if((data->is_pipe == 0) && (data->table_refiller == 0))
   {
-    if(QueueOpenFile(data) < 0)
-    {
-      data->end_reached = 1;
-      return -1;
-    }
-  }*/
+    QueueCloseFile(data);
+    data->is_binary = 0;
+  }
 
   if(data->table_refiller == 0)
   {
@@ -238,7 +745,11 @@ int QueueFill(struct table_data *data)
     err = pthread_create(&data->table_refiller, NULL, &QueueRefiller, data);
 
     if(err != 0)
+    {
+      data->table_refiller = 0;
       printf("can't create thread:[%s]", strerror(err));
+      return -1;
+    }
 
     //printf("[%d] Created process fill", data->nodeId);
   }
@@ -263,11 +774,11 @@ int QueueFill(struct table_data *data)
  */
 int QueueGet(struct table_data *data_in, struct table_data_read *data_out, int offset)
 {
-  int read_pointer;
+  unsigned int read_pointer;
 
   //printf("[%d] Trying to get data. . .", data_in->nodeId);
   // Controllo che l'offset non sia più grande dei dati che ho scritto nel buffer
-  if(offset > data_in->count)
+  if(offset > QueueCount(data_in))
   {
 #ifdef CANOPENSHELL_VERBOSE
 
@@ -279,10 +790,7 @@ int QueueGet(struct table_data *data_in, struct table_data_read *data_out, int o
     return -2;
   }
 
-  if((data_in->read_pointer + offset) < POSITION_DATA_NUM_MAX)
-    read_pointer = data_in->read_pointer + offset;
-  else
-    read_pointer = (data_in->read_pointer + offset) % POSITION_DATA_NUM_MAX;
+  read_pointer = (data_in->read_pointer + offset) & data_in->mask;
 
   if(data_in->type != 'S')
   {
@@ -296,8 +804,10 @@ int QueueGet(struct table_data *data_in, struct table_data_read *data_out, int o
     return -1;
   }
 
-  data_out->position = data_in->position[read_pointer];
-  data_out->time_ms = data_in->time_ms[read_pointer];
+  data_out->position = data_in->point[read_pointer].position;
+  data_out->time_ms = data_in->point[read_pointer].time_ms;
+  data_out->time_value = data_in->point[read_pointer].time_value;
+  data_out->time_period = data_in->point[read_pointer].time_period;
 
   //printf("pointer: %d, position: %ld, time: %ld\n", read_pointer, data_out->position, data_out->time_ms);
   return 0;
@@ -321,10 +831,10 @@ int QueueGet(struct table_data *data_in, struct table_data_read *data_out, int o
  */
 int QueueGetPipe(struct table_data *data_in, struct table_data_read *data_out, int offset)
 {
-  int read_pointer;
+  unsigned int read_pointer;
 
   // Controllo che l'offset non sia più grande dei dati che ho scritto nel buffer
-  if(offset > data_in->count)
+  if(offset > QueueCount(data_in))
   {
 #ifdef CANOPENSHELL_VERBOSE
 
@@ -336,13 +846,13 @@ int QueueGetPipe(struct table_data *data_in, struct table_data_read *data_out, i
     return -2;
   }
 
-  if((data_in->write_pointer - offset) < 0)
-    read_pointer = POSITION_DATA_NUM_MAX - (offset - data_in->write_pointer);
-  else
-    read_pointer = (data_in->write_pointer - offset);
+  read_pointer = (__atomic_load_n(&data_in->write_pointer, __ATOMIC_ACQUIRE) - offset)
+      & data_in->mask;
 
-  data_out->position = data_in->position[read_pointer];
-  data_out->time_ms = data_in->time_ms[read_pointer];
+  data_out->position = data_in->point[read_pointer].position;
+  data_out->time_ms = data_in->point[read_pointer].time_ms;
+  data_out->time_value = data_in->point[read_pointer].time_value;
+  data_out->time_period = data_in->point[read_pointer].time_period;
 
   //printf("pointer: %d, position: %ld, time: %ld\n", read_pointer, data_out->position, data_out->time_ms);
   return 0;
@@ -351,66 +861,356 @@ int QueueGetPipe(struct table_data *data_in, struct table_data_read *data_out, i
 /**
  * Legge l'ultimo dato  nella coda.
  *
+ * @return: 0 -> successo, -1 -> buffer non ancora allocato
+ *
  * @attention: assicurarsi che la coda sia stata scritta precedentemente, altrimenti
  * verrà restituito un valore casuale.
  */
 int QueueLast(struct table_data *data_in, struct table_data_read *data_out)
 {
-  int read_pointer;
+  unsigned int read_pointer;
+
+  if(data_in->point == NULL)
+    return -1;
+
+  read_pointer = (data_in->read_pointer - 1) & data_in->mask;
+
+  data_out->position = data_in->point[read_pointer].position;
+  data_out->time_ms = data_in->point[read_pointer].time_ms;
+  data_out->time_value = data_in->point[read_pointer].time_value;
+  data_out->time_period = data_in->point[read_pointer].time_period;
+
+  return 0;
+}
+
+/**
+ * Restituisce il numero di punti presenti nel buffer circolare.
+ *
+ * @remark: può essere chiamata sia dal produttore che dal consumatore senza
+ * mutex: il valore letto dall'altro thread può essere solo più vecchio, quindi
+ * il produttore vede al più meno spazio libero ed il consumatore al più meno
+ * punti disponibili.
+ */
+int QueueCount(struct table_data *data)
+{
+  unsigned int write_pointer = __atomic_load_n(&data->write_pointer, __ATOMIC_ACQUIRE);
+  unsigned int read_pointer = __atomic_load_n(&data->read_pointer, __ATOMIC_ACQUIRE);
+
+  return write_pointer - read_pointer;
+}
+
+/**
+ * Aggiorna le variabili del buffer circolare.
+ *
+ * I valori del buffer vengono presi direttamente dalla struttura ed questa funzione
+ * dovrebbe essere richiamata solo quando si è certi che i dati siano arrivati a
+ * destinazione.
+ *
+ * @remark: deve essere chiamata solo dal consumatore e non ha bisogno del mutex.
+ * Il mutex viene preso soltanto per risvegliare il riempitore, una volta per
+ * ogni attraversamento della soglia minima.
+ */
+void QueueUpdate(struct table_data *data, int point_number)
+{
+  int count = QueueCount(data);
 
-  if((data_in->read_pointer) > 0)
-    read_pointer = data_in->read_pointer - 1;
+  //printf("[%d] Queue update\n", data->nodeId);
+  if(point_number <= count)
+  {
+    __atomic_store_n(&data->read_pointer, data->read_pointer + point_number, __ATOMIC_RELEASE);
+
+    // risveglio il riempitore quando si scende sotto la soglia minima
+    if((count >= data->low_watermark) && ((count - point_number) < data->low_watermark))
+    {
+      pthread_mutex_lock(&data->table_mutex);
+      pthread_cond_signal(&data->table_refill);
+      pthread_mutex_unlock(&data->table_mutex);
+    }
+  }
   else
-    read_pointer = POSITION_DATA_NUM_MAX - 1;
+  {
+    if(data->end_reached == 0)
+      printf("ERR[%d on node %x]: punti incongruenti con il buffer (QueueUpdate).\n", InternalError,
+          data->nodeId);
+  }
+}
+
+/**
+ * Sposta il puntatore di lettura a point_number punti prima del puntatore di scrittura.
+ */
+int QueueSeek(struct table_data *data, int point_number)
+{
+  unsigned int write_pointer = __atomic_load_n(&data->write_pointer, __ATOMIC_ACQUIRE);
+
+  if(point_number > (int) (write_pointer - data->read_pointer))
+    return -1;
+
+  __atomic_store_n(&data->read_pointer, write_pointer - point_number, __ATOMIC_RELEASE);
+
+  return 0;
+}
+
+/**
+ * Posiziona la lettura del file sul primo punto che inizia all'istante
+ * start_time_ms o dopo.
+ *
+ * @return: 0 se il file è stato posizionato, -1 in caso di errore
+ *
+ * @remark: il checkpoint più vicino viene cercato nell'indice del file con una
+ * ricerca binaria, poi vengono scartati al massimo MOT_INDEX_CHECKPOINT_STEP
+ * punti. In questo modo il riempitore non deve rileggere l'inizio della tabella
+ * e riparte da lì a riempire la coda come al solito.
+ */
+int QueueSeekTime(struct table_data *data)
+{
+  struct mot_index index;
+  const struct mot_index_checkpoint *checkpoint;
+  struct line_record record;
+  struct motb_record binary_record;
+  uint64_t elapsed_time;
+  long line_count;
+  long line_start;
+  const char *line;
+  const char *line_end;
+  ssize_t read;
+
+  if(FileIndexLoad(data->nodeId, &index) < 0)
+    return -1;
+
+  checkpoint = MotIndexCheckpointFind(&index, data->start_time_ms);
+
+  if((checkpoint == NULL) || (data->start_time_ms >= index.header.total_time_ms))
+  {
+    MotIndexFree(&index);
+    return -1;
+  }
+
+  elapsed_time = checkpoint->time_ms;
+
+  if(data->is_binary)
+  {
+    // i record hanno lunghezza fissa: il punto si trova direttamente
+    if(fseek(data->position_file,
+        sizeof(struct motb_header) + checkpoint->point * sizeof(binary_record), SEEK_SET) != 0)
+    {
+      MotIndexFree(&index);
+      return -1;
+    }
+
+    line_count = checkpoint->point;
+
+    while(elapsed_time < data->start_time_ms)
+    {
+      if(fread(&binary_record, sizeof(binary_record), 1, data->position_file) != 1)
+        break;
+
+      elapsed_time += MotbTimeDecode(binary_record.time_value, binary_record.time_period);
+      line_count++;
+    }
+
+    data->cursor_position = sizeof(struct motb_header) + line_count * sizeof(binary_record);
+  }
+  else
+  {
+    if((mmap_flag == 0) && ((QueueOpenFile(data) < 0)
+        || (fseek(data->position_file, checkpoint->byte_offset, SEEK_SET) != 0)))
+    {
+      MotIndexFree(&index);
+      return -1;
+    }
+
+    line_count = checkpoint->line;
+    data->cursor_position = checkpoint->byte_offset;
+
+    while(1)
+    {
+      line_start = data->cursor_position;
+
+      if(mmap_flag == 0)
+      {
+        if((read = getline(&data->line_buffer, &data->line_buffer_size, data->position_file)) == -1)
+          break;
+
+        line = data->line_buffer;
+        line_end = line + read;
+      }
+      else
+      {
+        if(data->cursor_position >= (long) data->position_map_size)
+          break;
+
+        line = data->position_map + data->cursor_position;
+        line_end = memchr(line, '\n', data->position_map_size - data->cursor_position);
+        line_end = (line_end == NULL) ? data->position_map + data->position_map_size : line_end + 1;
+      }
+
+      if((LineParse(line, line_end, &record) == LINE_OK) && (record.type == 'S'))
+      {
+        // la riga viene lasciata al riempitore
+        if(elapsed_time >= data->start_time_ms)
+        {
+          if((mmap_flag == 0) && (fseek(data->position_file, line_start, SEEK_SET) != 0))
+          {
+            MotIndexFree(&index);
+            return -1;
+          }
+
+          break;
+        }
+
+        elapsed_time += record.time_ms;
+      }
+
+      data->cursor_position += line_end - line;
+      line_count++;
+    }
+  }
+
+#ifdef CANOPENSHELL_VERBOSE
+  if(verbose_flag)
+  {
+    printf("INF[%d on node %x]: simulazione da %llu ms, riga %ld\n", InternalError, data->nodeId,
+        (unsigned long long) elapsed_time, line_count + 1);
+  }
+#endif
+
+  row_read[data->nodeId] = line_count;
+
+  MotIndexFree(&index);
+
+  return 0;
+}
+
+/**
+ * Stampa il motivo per cui una riga del file è stata scartata.
+ */
+static void QueueLineWarning(struct table_data *data, long line_number, const char *reason,
+    int column)
+{
+#ifdef CANOPENSHELL_VERBOSE
+  if(verbose_flag)
+  {
+    printf("WARN[%d on node %x]: Riga %ld non valida (%s, colonna %d)\n", InternalError,
+        data->nodeId, line_number, reason, column);
+  }
+#endif
+}
+
+/**
+ * Verifica una riga del file tabella e, se valida, la aggiunge al buffer circolare.
+ *
+ * @input line: inizio della riga, analizzata senza copiarla
+ * @input end: fine della riga
+ * @input line_count: indice della riga all'interno della ricarica corrente
+ *
+ * @return: 0 -> riga scartata
+ *          1 -> punto aggiunto alla coda
+ *          2 -> coda piena (il punto è stato aggiunto se c'era posto)
+ *
+ * @remark: è la parte comune a QueuePut, QueuePutMap e QueuePutPipe. Quando
+ * viene riscontrato un errore, il parametro "type" viene sovrascritto con "E".
+ */
+static int QueueLineStore(struct table_data *data, const char *line, const char *end,
+    int line_count)
+{
+  struct line_record record;
+  char event_text[48];
+  long line_number = row_read[data->nodeId] + line_count;
+  unsigned int write_pointer = data->write_pointer;
+  int line_status;
+  long time_ms;
+
+  // il consumatore non può essere scavalcato: la riga viene scartata
+  if(QueueCount(data) >= data->capacity)
+    return 2;
+
+  line_status = LineParse(line, end, &record);
+
+  switch(line_status)
+  {
+    case LINE_EMPTY:
+      return 0;
+
+    case LINE_ERR_HEADER:
+      QueueLineWarning(data, line_number, "sintassi CT1 M", record.column);
+      data->type = 'E';
+      return 0;
+
+    case LINE_ERR_NODEID:
+      QueueLineWarning(data, line_number, "sintassi nodeid", record.column);
+      return 0;
+
+    default:
+      break;
+  }
+
+  // controllo che l'indirizzo del motore combaci
+  if(record.nodeid != data->nodeId)
+  {
+    QueueLineWarning(data, line_number, "nodeid", 6);
+    data->type = 'E';
+    return 0;
+  }
 
-  data_out->position = data_in->position[read_pointer];
-  data_out->time_ms = data_in->time_ms[read_pointer];
+  if(line_status == LINE_ERR_TYPE)
+  {
+    QueueLineWarning(data, line_number, "sintassi tipo", record.column);
+    data->type = 'E';
+    return 0;
+  }
 
-  return 0;
-}
+  if(line_status == LINE_OK)
+  {
+    // se non è la prima riga letta, la riga di homing deve essere ignorata
+    if((record.type == 'H') && ((row_read[data->nodeId] != 0) || (line_count != 0)))
+    {
+      line_status = LINE_ERR_FIELD;
+      record.column = 1;
+    }
+    else if((record.type != 'H') && (record.type != 'S'))
+    {
+      line_status = LINE_ERR_FIELD;
+      record.column = 1;
+    }
+  }
 
-/**
- * Aggiorna le variabili del buffer circolare.
- *
- * I valori del buffer vengono presi direttamente dalla struttura ed questa funzione
- * dovrebbe essere richiamata solo quando si è certi che i dati siano arrivati a
- * destinazione.
- *
- */
-void QueueUpdate(struct table_data *data, int point_number)
-{
-  //printf("[%d] Queue update\n", data->nodeId);
-  if(point_number <= data->count)
+  if(line_status != LINE_OK)
   {
-    data->read_pointer += point_number;
+    QueueLineWarning(data, line_number, "parametri", record.column);
 
-    if(data->read_pointer >= POSITION_DATA_NUM_MAX)
-      data->read_pointer = data->read_pointer % POSITION_DATA_NUM_MAX;
+    data->type = 'E';
 
-    data->count -= point_number;
+    sprintf(event_text, "linea %ld colonna %d", line_number + 1, record.column);
+    add_event(CERR_FileError, data->nodeId, 0, event_text);
+
+    return 0;
   }
-  else
+
+  data->type = record.type;
+
+  if(record.type == 'H')
   {
-    if(data->end_reached == 0)
-      printf("ERR[%d on node %x]: punti incongruenti con il buffer (QueueUpdate).\n", InternalError,
-          data->nodeId);
+    data->offset = record.position;
+    data->forward_velocity = record.forward_velocity;
+    data->backward_velocity = record.backward_velocity;
   }
-}
+  else
+  {
+    write_pointer &= data->mask;
 
-/**
- * Sposta il puntatore di lettura a point_number punti prima del puntatore di scrittura.
- */
-int QueueSeek(struct table_data *data, int point_number)
-{
-  if(point_number > data->count)
-    return -1;
+    data->point[write_pointer].position = record.position;
 
-  if((data->write_pointer - point_number) < 0)
-    data->read_pointer = POSITION_DATA_NUM_MAX - (point_number - data->write_pointer);
-  else
-    data->read_pointer = data->write_pointer - point_number;
+    // il tempo in coda è quello che eseguirà il motore, con l'errore di
+    // codifica dei punti precedenti già recuperato
+    time_ms = MotbTimeEncode(&data->time_encoder, record.time_ms,
+        &data->point[write_pointer].time_value, &data->point[write_pointer].time_period);
+    data->point[write_pointer].time_ms = (time_ms > LINE_TIME_MAX) ? LINE_TIME_MAX : time_ms;
+  }
 
-  return 0;
+  // pubblico il punto al consumatore solo dopo averlo scritto
+  __atomic_store_n(&data->write_pointer, data->write_pointer + 1, __ATOMIC_RELEASE);
+
+  return (QueueCount(data) >= data->capacity) ? 2 : 1;
 }
 
 /**
@@ -436,276 +1236,166 @@ int QueueSeek(struct table_data *data, int point_number)
  */
 int QueuePut(struct table_data *data, int line_number)
 {
-  FILE *file = NULL;
-  char *line = NULL;
-  size_t len = 0;
   ssize_t read;
-
-  char *token;
-  char *token_save;
-  char line_copy[256];
-  char file_path[256];
-  char position[12];
-  char time[12];
-  char vel_forw[12];
-  char vel_backw[12];
-  char nodeid[3];
   int line_count = 0;
-  long value;
 
   if(data->end_reached == 1)
     return 0;
 
-  if(data->count == POSITION_DATA_NUM_MAX)
+  if(QueueCount(data) >= data->capacity)
     return -2;
 
-  if(fake_flag == 0)
-   sprintf(file_path, "%s%d.mot", FILE_DIR, data->nodeId);
-   else
-   sprintf(file_path, "%s%d.mot.fake", FILE_DIR, data->nodeId);
-
-   file = fopen(file_path, "r");
-
-   if(file == NULL)
-   {
- #ifdef CANOPENSHELL_VERBOSE
-     if(verbose_flag)
-       perror("file");
- #endif
-     return -1;
-   }
-
-  /*if(data->position_file == NULL)
-  {
-#ifdef CANOPENSHELL_VERBOSE
-    if(verbose_flag)
-      perror("file");
-#endif
+  if(data->is_binary)
+    return QueuePutBinary(data, line_number);
 
-    data->end_reached = 1;
-    return -1;
-  }*/
+  if(mmap_flag)
+    return QueuePutMap(data, line_number);
 
-  if(fseek(file, data->cursor_position, SEEK_SET) != 0)
-  //if(fseek(data->position_file, data->cursor_position, SEEK_SET) != 0)
-  {
-    fclose(file);
+  // il file resta aperto tra una ricarica e l'altra
+  if(QueueOpenFile(data) < 0)
     return -1;
-  }
 
   for(line_count = 0; line_count < line_number; line_count++)
   {
-    // Ogni informazione è delimitata da uno spazio
-    if((read = getline(&line, &len, file)) != -1)
-    //if((read = getline(&line, &len, data->position_file)) != -1)
+    // il buffer della riga viene riutilizzato tra una ricarica e l'altra
+    if((read = getline(&data->line_buffer, &data->line_buffer_size, data->position_file)) == -1)
     {
-      if(strcmp(line, "\n") == 0)
-        continue;
-
-      // controllo se la riga entra nel buffer
-      if(len < sizeof(line_copy))
-        strcpy(line_copy, line);
-      else
-        strncpy(line_copy, line, sizeof(line_copy));
-
-      // Verifico la sintassi
-      if(strncmp(line_copy, "CT1 M", strlen("CT1 M")))
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("WARN[%d on node %x]: Riga %ld non valida (sintassi CT1 M)\n", InternalError,
-              data->nodeId, row_read[data->nodeId] + line_count);
-
-          printf("line: %s, row read: %ld, line count: %d\n", line, row_read[data->nodeId],
-              line_count);
-          printf("cursor position on error: %ld\n", data->cursor_position);
-        }
-#endif
-        data->type = 'E';
+      __atomic_store_n(&data->end_reached, 1, __ATOMIC_RELEASE);
 
-        data->cursor_position += read;
+      QueueCloseFile(data);
 
-        continue;
-      }
+      break;
+    }
 
-      // controllo che l'indirizzo del motore combaci
-      token = strtok_r(line_copy + 5, " ", &token_save);
-      if(token != NULL)
-      {
-        strcpy(nodeid, token);
+    data->cursor_position += read;
 
-        if(atoi(nodeid) != data->nodeId)
-        {
-#ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag)
-          {
-            printf("WARN[%d on node %x]: Riga %ld non valida (nodeid)\n", InternalError,
-                data->nodeId, row_read[data->nodeId] + line_count);
+    if(QueueLineStore(data, data->line_buffer, data->line_buffer + read, line_count) == 2)
+      break;
+  }
 
-            printf("line: %s", line);
-          }
-#endif
+  row_read[data->nodeId] += line_count + 1;
 
-          data->type = 'E';
+  return line_count;
+}
 
-          data->cursor_position += read;
+/**
+ * Aggiunge alla coda i punti letti dal file compilato .motb.
+ *
+ * @return >= 0: punti letti; -1: errore file -2: buffer pieno
+ *
+ * @remark: i record sono già validati dal checksum in apertura e contengono
+ * il tempo già codificato, quindi vengono copiati direttamente nel buffer
+ * circolare.
+ */
+int QueuePutBinary(struct table_data *data, int line_number)
+{
+  struct motb_record record[64];
+  size_t record_request;
+  size_t record_read;
+  unsigned int write_pointer;
+  long time_ms;
+  int line_count = 0;
+  int i;
 
-          continue;
-        }
-      }
-      else
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("WARN[%d on node %x]: Riga %ld non valida (sintassi nodeid)\n", InternalError,
-              data->nodeId, row_read[data->nodeId] + line_count);
+  if(data->position_file == NULL)
+    return -1;
 
-          printf("line: %s", line);
-        }
-#endif
-        data->cursor_position += read;
+  while(line_count < line_number)
+  {
+    record_request = line_number - line_count;
 
-        continue;
-      }
+    if(record_request > (sizeof(record) / sizeof(record[0])))
+      record_request = sizeof(record) / sizeof(record[0]);
 
-      // determino il tipo di riga letta
-      token = strtok_r(NULL, " ", &token_save);
-      if(token != NULL)
-      {
-        data->type = *token;
-        strcpy(position, token + 1);
-      }
-      else
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("WARN[%d on node %x]: Riga %ld non valida (sintassi tipo)\n", InternalError,
-              data->nodeId, row_read[data->nodeId] + line_count);
+    record_read = fread(record, sizeof(record[0]), record_request, data->position_file);
 
-          printf("line: %s", line);
-        }
-#endif
+    for(i = 0; i < record_read; i++)
+    {
+      write_pointer = (data->write_pointer + i) & data->mask;
+      time_ms = MotbTimeDecode(record[i].time_value, record[i].time_period);
+
+      data->point[write_pointer].position = record[i].position;
+      data->point[write_pointer].time_value = record[i].time_value;
+      data->point[write_pointer].time_period = record[i].time_period;
+      data->point[write_pointer].time_ms = (time_ms > LINE_TIME_MAX) ? LINE_TIME_MAX : time_ms;
+
+      // i tempi sono stati codificati dalla conversione, che ha salvato l'errore
+      data->time_encoder.encoded_ms += time_ms;
+      data->time_encoder.residual_ms = record[i].time_residual;
+      data->time_encoder.source_ms = data->time_encoder.encoded_ms + record[i].time_residual;
+    }
 
-        data->type = 'E';
+    data->type = 'S';
+    data->cursor_position += record_read * sizeof(record[0]);
+    line_count += record_read;
 
-        data->cursor_position += read;
-        continue;
-      }
+    __atomic_store_n(&data->write_pointer, data->write_pointer + record_read, __ATOMIC_RELEASE);
 
-      // a seconda del tipo di dato, leggo i parametri successivi
-      switch(data->type)
+    if(record_read < record_request)
+    {
+      if(feof(data->position_file))
       {
-        case 'S':
-          // copio il tempo
-          token = strtok_r(NULL, " \n\r\a", &token_save);
-          if(token != NULL)
-          {
-            value = strtol((token + 1), NULL, 10);
-
-            if((*token == 'T') && (*(token + 1) != '\0') && (value != ERANGE) && (value != 0))
-              strcpy(time, token + 1);
-            else
-              goto fault;
-          }
-          else
-            goto fault;
-
-          long lposition = atol(position);
-          long ltime = atol(time);
+        __atomic_store_n(&data->end_reached, 1, __ATOMIC_RELEASE);
 
-          memcpy(&data->position[data->write_pointer], &lposition,
-              sizeof(data->position[data->write_pointer]));
-
-          memcpy(&data->time_ms[data->write_pointer], &ltime,
-              sizeof(data->time_ms[data->write_pointer]));
-
-          break;
-
-        case 'H':
-          // se non è la prima riga letta, allora la devo ignoare
-          if((row_read[data->nodeId] != 0) || line_count != 0)
-            goto fault;
-
-          // copio le velocità di andata e ritorno
-          token = strtok_r(NULL, " ", &token_save);
-          if(token != NULL)
-          {
-            if(strncmp(token, "VF", 2) == 0)
-              strcpy(vel_forw, token + 2);
-            else
-              goto fault;
-          }
-          else
-            goto fault;
-
-          token = strtok_r(NULL, " \n\r\a", &token_save);
-          if(token != NULL)
-          {
-            if(strncmp(token, "VB", 2) == 0)
-              strcpy(vel_backw, token + 2);
-            else
-              goto fault;
-          }
-          else
-            goto fault;
-
-          data->offset = atol(position);
-          data->forward_velocity = atol(vel_forw);
-          data->backward_velocity = atol(vel_backw);
-
-          //return 1;
-          break;
-
-        default:
-          fault:
+        QueueCloseFile(data);
+      }
 
-          data->type = 'E';
+      break;
+    }
+  }
 
-          data->cursor_position += read;
+  row_read[data->nodeId] += line_count;
 
-          sprintf(line_copy, "linea %ld", row_read[data->nodeId] + line_count + 1);
-          add_event(CERR_FileError, data->nodeId, 0, line_copy);
+  return line_count;
+}
 
-          continue;
-          break;
-      }
+/**
+ * Aggiunge alla coda i valori letti dal file di simulazione mappato in memoria.
+ *
+ * @return >= 0: letta una nuova riga; -1: errore file -2: buffer pieno
+ *
+ * @remark: stesso comportamento di QueuePut, ma le righe vengono analizzate
+ * direttamente nella mappatura, senza getline e senza copie.
+ */
+int QueuePutMap(struct table_data *data, int line_number)
+{
+  const char *line;
+  const char *line_end;
+  const char *map_end;
+  int line_count = 0;
 
-      data->cursor_position += read;
+  if(QueueMapFile(data) < 0)
+    return -1;
 
-      data->write_pointer++;
+  map_end = data->position_map + data->position_map_size;
 
-      if(data->write_pointer >= POSITION_DATA_NUM_MAX)
-        data->write_pointer = 0;
+  for(line_count = 0; line_count < line_number; line_count++)
+  {
+    if(data->cursor_position >= (long) data->position_map_size)
+    {
+      __atomic_store_n(&data->end_reached, 1, __ATOMIC_RELEASE);
 
-      pthread_mutex_lock(&data->table_mutex);
+      QueueCloseFile(data);
 
-      data->count++;
+      break;
+    }
 
-      if(data->count == POSITION_DATA_NUM_MAX)
-      {
-        pthread_mutex_unlock(&data->table_mutex);
+    line = data->position_map + data->cursor_position;
+    line_end = memchr(line, '\n', map_end - line);
 
-        break;
-      }
-      else
-        pthread_mutex_unlock(&data->table_mutex);
-    }
+    if(line_end == NULL)
+      line_end = map_end;
     else
-    {
-      data->end_reached = 1;
+      line_end++;
+
+    data->cursor_position += line_end - line;
 
+    if(QueueLineStore(data, line, line_end, line_count) == 2)
       break;
-    }
   }
 
   row_read[data->nodeId] += line_count + 1;
 
-  free(line);
-  fclose(file);
-
   return line_count;
 }
 
@@ -720,22 +1410,8 @@ int QueuePut(struct table_data *data, int line_number)
  */
 int QueuePutPipe(struct table_data *data, int line_number)
 {
-  //FILE *file = NULL;
-  char *line = NULL;
-  size_t len = 0;
   ssize_t read;
-
-  char *token;
-  char *token_save;
-  char line_copy[256];
-  //char file_path[256];
-  char position[12];
-  char time[12];
-  char vel_forw[12];
-  char vel_backw[12];
-  char nodeid[3];
   int line_count = 0;
-  long value;
 
   if(data->end_reached == 1)
     return 0;
@@ -751,199 +1427,18 @@ int QueuePutPipe(struct table_data *data, int line_number)
 
   for(line_count = 0; line_count < line_number; line_count++)
   {
-    // Ogni informazione è delimitata da uno spazio
-    //if((read = getline(&line, &len, file)) != -1)
-    if((read = getline(&line, &len, data->position_file)) != -1)
-    {
-      if(strcmp(line, "\n") == 0)
-        continue;
-
-      // controllo se la riga entra nel buffer
-      if(len < sizeof(line_copy))
-        strcpy(line_copy, line);
-      else
-        strncpy(line_copy, line, sizeof(line_copy));
-
-      // Verifico la sintassi
-      if(strncmp(line_copy, "CT1 M", strlen("CT1 M")))
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("WARN[%d on node %x]: Riga %ld non valida (sintassi CT1 M)\n", InternalError,
-              data->nodeId, row_read[data->nodeId] + line_count);
-
-          printf("line: %s", line);
-        }
-#endif
-        data->type = 'E';
-
-        continue;
-      }
-
-      // controllo che l'indirizzo del motore combaci
-      token = strtok_r(line_copy + 5, " ", &token_save);
-      if(token != NULL)
-      {
-        strcpy(nodeid, token);
-
-        if(atoi(nodeid) != data->nodeId)
-        {
-#ifdef CANOPENSHELL_VERBOSE
-          if(verbose_flag)
-          {
-            printf("WARN[%d on node %x]: Riga %ld non valida (nodeid)\n", InternalError,
-                data->nodeId, row_read[data->nodeId] + line_count);
-
-            printf("line: %s", line);
-          }
-#endif
-
-          data->type = 'E';
-
-          continue;
-        }
-      }
-      else
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("WARN[%d on node %x]: Riga %ld non valida (sintassi nodeid)\n", InternalError,
-              data->nodeId, row_read[data->nodeId] + line_count);
-
-          printf("line: %s", line);
-        }
-#endif
-
-        continue;
-      }
-
-      // determino il tipo di riga letta
-      token = strtok_r(NULL, " ", &token_save);
-      if(token != NULL)
-      {
-        data->type = *token;
-        strcpy(position, token + 1);
-      }
-      else
-      {
-#ifdef CANOPENSHELL_VERBOSE
-        if(verbose_flag)
-        {
-          printf("WARN[%d on node %x]: Riga %ld non valida (sintassi tipo)\n", InternalError,
-              data->nodeId, row_read[data->nodeId] + line_count);
-
-          printf("line: %s", line);
-        }
-#endif
-
-        data->type = 'E';
-        continue;
-      }
-
-      // a seconda del tipo di dato, leggo i parametri successivi
-      switch(data->type)
-      {
-        case 'S':
-          // copio il tempo
-          token = strtok_r(NULL, " \n\r\a", &token_save);
-          if(token != NULL)
-          {
-            value = strtol((token + 1), NULL, 10);
-
-            if((*token == 'T') && (*(token + 1) != '\0') && (value != ERANGE) && (value != 0))
-              strcpy(time, token + 1);
-            else
-              goto fault;
-          }
-          else
-            goto fault;
-
-          long lposition = atol(position);
-          long ltime = atol(time);
-
-          memcpy(&data->position[data->write_pointer], &lposition,
-              sizeof(data->position[data->write_pointer]));
-
-          memcpy(&data->time_ms[data->write_pointer], &ltime,
-              sizeof(data->time_ms[data->write_pointer]));
-
-          break;
-
-        case 'H':
-          // se non è la prima riga letta, allora la devo ignoare
-          if((row_read[data->nodeId] != 0) || line_count != 0)
-            goto fault;
-
-          // copio le velocità di andata e ritorno
-          token = strtok_r(NULL, " ", &token_save);
-          if(token != NULL)
-          {
-            if(strncmp(token, "VF", 2) == 0)
-              strcpy(vel_forw, token + 2);
-            else
-              goto fault;
-          }
-          else
-            goto fault;
-
-          token = strtok_r(NULL, " \n\r\a", &token_save);
-          if(token != NULL)
-          {
-            if(strncmp(token, "VB", 2) == 0)
-              strcpy(vel_backw, token + 2);
-            else
-              goto fault;
-          }
-          else
-            goto fault;
-
-          data->offset = atol(position);
-          data->forward_velocity = atol(vel_forw);
-          data->backward_velocity = atol(vel_backw);
-
-          //return 1;
-          break;
-
-        default:
-          fault:
-
-          data->type = 'E';
-
-          sprintf(line_copy, "linea %ld", row_read[data->nodeId] + line_count + 1);
-          add_event(CERR_FileError, data->nodeId, 0, line_copy);
-
-          continue;
-          break;
-      }
-
-      // aggiorno il buffer circolare
-      data->write_pointer++;
-
-      if(data->write_pointer >= POSITION_DATA_NUM_MAX)
-        data->write_pointer = 0;
-
-      pthread_mutex_lock(&data->table_mutex);
-
-      if(data->count < POSITION_DATA_NUM_MAX)
-        data->count++;
-
-      pthread_mutex_unlock(&data->table_mutex);
-    }
-    else
+    if((read = getline(&data->line_buffer, &data->line_buffer_size, data->position_file)) == -1)
     {
       data->end_reached = 1;
 
       break;
     }
+
+    QueueLineStore(data, data->line_buffer, data->line_buffer + read, line_count);
   }
 
   row_read[data->nodeId] += line_count + 1;
 
-  free(line);
-  //fclose(file);
-
   return line_count;
 }
 
@@ -954,22 +1449,17 @@ int QueuePutPipe(struct table_data *data, int line_number)
  *
  * @remark: questa funzione, come QueuePut, legge dal file le posizioni. Visto
  * però che, in questo caso, si lavora con una pipe, la lettura viene fatta in
- * modo continuo. Visto che non c'è un buffer circolare, la variabile write_pointer
- * è stata utilizzata per indicare quando è arrivato il comando di start, mentre
- * read_pointer indica quando è arrivata una stringa riguardante il motore.
+ * modo continuo. Visto che non c'è un buffer circolare, l'ultima posizione viene
+ * scritta in stream_position della tabella del motore, position_start indica quando è
+ * arrivato il comando di start, mentre position_update indica quando è arrivata
+ * una stringa riguardante il motore.
  */
 int QueuePutPositionPipe(struct table_data *data)
 {
-  char *line = NULL;
-  size_t len = 0;
+  struct line_record record;
+  char event_text[48];
   ssize_t read;
-
-  char line_copy[256];
-  long lposition;
-  long lvelocity;
-  long lacceleration;
-  int start_flag;
-  int nodeid;
+  int line_status;
   int line_count = 0;
 
   if(data->end_reached == 1)
@@ -984,32 +1474,23 @@ int QueuePutPositionPipe(struct table_data *data)
     return -1;
   }
 
-  int parse_num;
-  // Ogni informazione è delimitata da uno spazio
-  //if((read = getline(&line, &len, file)) != -1)
-  if((read = getline(&line, &len, data->position_file)) != -1)
+  if((read = getline(&data->line_buffer, &data->line_buffer_size, data->position_file)) != -1)
   {
-    if(strcmp(line, "\n") == 0)
-      return -1;
-
-    // controllo se la riga entra nel buffer
-    if(len < sizeof(line_copy))
-      strcpy(line_copy, line);
-    else
-      strncpy(line_copy, line, sizeof(line_copy));
+    line_status = LineParse(data->line_buffer, data->line_buffer + read, &record);
 
-    parse_num = sscanf(line_copy, "CT1 M%d P%ld VM%ld AM%ld %d\n", &nodeid, &lposition, &lvelocity,
-        &lacceleration, &start_flag);
+    if(line_status == LINE_EMPTY)
+      return -1;
 
-    if(parse_num >= 4)
+    if((line_status == LINE_OK) && (record.type == 'P'))
     {
       if(data->nodeId == 0)
       {
         int i;
 
-        for(i = (TABLE_MAX_NUM + 1); i >= 0; i--)
+        // la tabella di broadcast è l'ultima dell'array, dopo quelle dei motori
+        for(i = (TABLE_MAX_NUM - 1); i >= 0; i--)
         {
-          if(data[i - TABLE_MAX_NUM + 1].nodeId == nodeid)
+          if(data[i - TABLE_MAX_NUM].nodeId == record.nodeid)
           {
             break;
           }
@@ -1019,42 +1500,37 @@ int QueuePutPositionPipe(struct table_data *data)
           goto fault;
 
         pthread_mutex_lock(&data->table_mutex);
-        data[i - TABLE_MAX_NUM + 1].read_pointer = 1;
-        data[i - TABLE_MAX_NUM + 1].position[0] = lposition;
-        data[i - TABLE_MAX_NUM + 1].forward_velocity = lvelocity;
+        data[i - TABLE_MAX_NUM].position_update = 1;
+        data[i - TABLE_MAX_NUM].stream_position = record.position;
+        data[i - TABLE_MAX_NUM].forward_velocity = record.velocity;
         pthread_mutex_unlock(&data->table_mutex);
 
-        if((parse_num == 5) && (start_flag > 0))
+        if(record.start_flag > 0)
         {
-          data[i - TABLE_MAX_NUM + 1].write_pointer = 1;
+          data[i - TABLE_MAX_NUM].position_start = 1;
         }
       }
       else
       {
         pthread_mutex_lock(&data->table_mutex);
-        data->read_pointer = 1;
-        data->position[0] = lposition;
-        data->forward_velocity = lvelocity;
+        data->position_update = 1;
+        data->stream_position = record.position;
+        data->forward_velocity = record.velocity;
         pthread_mutex_unlock(&data->table_mutex);
 
-        if((parse_num == 5) && (start_flag > 0))
+        if(record.start_flag > 0)
         {
-          data->write_pointer = 1;
+          data->position_start = 1;
         }
       }
     }
     else
     {
-#ifdef CANOPENSHELL_VERBOSE
-      if(verbose_flag)
-      {
-        printf("WARN[%d on node %x]: Riga %ld non valida (sintassi CT1 M)\n", InternalError,
-            data->nodeId, row_read[data->nodeId] + line_count);
+      if(line_status == LINE_OK)
+        record.column = 1;
 
-        printf("line: %s", line);
-      }
-#endif
-      data->type = 'E';
+      QueueLineWarning(data, row_read[data->nodeId] + line_count, "sintassi CT1 M P VM AM",
+          record.column);
 
       goto fault;
     }
@@ -1066,16 +1542,14 @@ int QueuePutPositionPipe(struct table_data *data)
 
   row_read[data->nodeId] += line_count + 1;
 
-  free(line);
-  //fclose(file);
-
   return line_count;
 
   fault:
 
   data->type = 'E';
-  sprintf(line_copy, "linea %ld", row_read[data->nodeId] + line_count + 1);
-  add_event(CERR_FileError, data->nodeId, 0, line_copy);
+  sprintf(event_text, "linea %ld colonna %d", row_read[data->nodeId] + line_count + 1,
+      record.column);
+  add_event(CERR_FileError, data->nodeId, 0, event_text);
 
   return -1;
 }
@@ -8,14 +8,45 @@
 #ifndef FILE_PARSER_H_
 #define FILE_PARSER_H_
 
+#include <stdint.h>
+#include "motb_file.h"
+
 #define FILE_DIR "/tmp/spinitalia/motor_data/"
-#define POSITION_DATA_NUM_MAX 450 // non deve essere minore del massimo indirizzo dei motori
+#define POSITION_DATA_NUM_MAX 512 // capacità predefinita del buffer circolare, deve essere una potenza di 2
+#define POSITION_DATA_NUM_MIN 16 // capacità minima configurabile
+#define POSITION_DATA_NUM_LIMIT 65536 // capacità massima configurabile
+#define CACHE_LINE_SIZE 64
+#define POSITION_FILE_BUFFER_SIZE 65536 // buffer di lettura del file tabella
+
+/**
+ * Punto della tabella come viene conservato nel buffer circolare: 8 byte,
+ * quindi 8 punti per linea di cache.
+ */
+struct table_point
+{
+  int32_t position; /**< posizione da raggiungere in passi encoder */
+  uint16_t time_ms; /**< tempo codificato per arrivare alla posizione in ms */
+  uint8_t time_value; /**< tempo codificato per l'interpolatore: unità */
+  int8_t time_period; /**< tempo codificato per l'interpolatore: esponente */
+};
+
+/**
+ * Dimensioni del buffer circolare richieste con QueueConfigure, applicate
+ * dal successivo QueueInit (0 indica il valore predefinito).
+ */
+struct table_config
+{
+  unsigned int capacity; /**< numero di punti, potenza di 2 */
+  int low_watermark; /**< soglia di ricarica, predefinita metà di high_watermark */
+  int high_watermark; /**< livello di riempimento, predefinito pari a capacity */
+};
 
 struct table_data
 {
   int nodeId;
-  long position[POSITION_DATA_NUM_MAX]; /**< posizione da raggiungere in passi encoder */
-  long time_ms[POSITION_DATA_NUM_MAX]; /**< tempo per arrivare alla posizione in ms (solo per comando posizione/interpolazione */
+  struct table_point *point; /**< buffer circolare, allocato da QueueInit */
+  unsigned int capacity; /**< numero di elementi di point, potenza di 2 */
+  unsigned int mask; /**< capacity - 1 */
 
   long offset; /**< offset dal limite di giunto (solo per comando homing) */
   long forward_velocity; /**< velocità di ricerca limite di giunto (solo per comando di homing) */
@@ -23,16 +54,40 @@ struct table_data
 
   char type; /**< tipo di dato letto "H": riga di homing, "S": riga tabella */
 
-  int write_pointer; /**< dove sono arrivato a scrivere */
-  int read_pointer; /**< dove sono arrivato a leggere */
-  int count; /**< numero di elementi presenti nel buffer */
+  /**
+   * Il buffer circolare ha un solo produttore (il riempitore) ed un solo
+   * consumatore (SimulationTableUpdate). I due indici crescono sempre e vengono
+   * ridotti con mask solo per accedere all'elemento: il numero di
+   * punti presenti è la loro differenza (vedi QueueCount). Ognuno dei due indici
+   * viene scritto da un solo thread, con operazioni atomiche, ed è allineato su
+   * una linea di cache diversa per non rimbalzarla tra i due thread.
+   */
+  unsigned int write_pointer __attribute__((aligned(CACHE_LINE_SIZE))); /**< dove sono arrivato a scrivere (produttore) */
+  unsigned int read_pointer __attribute__((aligned(CACHE_LINE_SIZE))); /**< dove sono arrivato a leggere (consumatore) */
+
+  long stream_position __attribute__((aligned(CACHE_LINE_SIZE))); /**< ultima posizione arrivata dalla pipe (movimento libero) */
+  int position_update; /**< è arrivata una nuova posizione dalla pipe (movimento libero) */
+  int position_start; /**< è arrivato il comando di start dalla pipe (movimento libero) */
 
   FILE *position_file; /**< file da cui leggere le posizioni per la simulazione */
+  char *position_file_buffer; /**< buffer di lettura associato a position_file */
+  char *position_map; /**< file delle posizioni mappato in memoria (modalità mmap) */
+  size_t position_map_size; /**< dimensione della mappatura */
+  char *line_buffer; /**< buffer della riga letta, riutilizzato da getline */
+  size_t line_buffer_size; /**< dimensione di line_buffer */
   long cursor_position; /**< dove sono arrivato nel file delle posizioni */
   int end_reached; /**< indica se non ci sono più punti da inserire nella tabella */
   int is_pipe;
+  int is_binary; /**< le posizioni vengono lette dal file compilato .motb */
+
+  struct table_config config; /**< dimensioni richieste per il buffer circolare */
+  int low_watermark; /**< sotto questo numero di punti il riempitore viene risvegliato */
+  int high_watermark; /**< il riempitore riempie la coda fino a questo numero di punti */
+  long start_time_ms; /**< istante della tabella da cui iniziare la simulazione */
+  struct motb_time_encoder time_encoder; /**< codifica dei tempi dei punti messi in coda */
 
   pthread_mutex_t table_mutex; /**< sincro tra diversi thread */
+  pthread_cond_t table_refill; /**< risveglia il riempitore quando la coda si svuota */
   pthread_t table_refiller; /**< thread per tenere la tabella piena */
 };
 
@@ -40,11 +95,16 @@ struct table_data_read
 {
   long position; /**< posizione da raggiungere in passi encoder */
   long time_ms; /**< tempo per arrivare alla posizione in ms */
+  unsigned char time_value; /**< tempo codificato per l'interpolatore: unità */
+  signed char time_period; /**< tempo codificato per l'interpolatore: esponente */
 };
 
 
-void QueueInit(int nodeid, struct table_data *data);
+int QueueInit(int nodeid, struct table_data *data);
+int QueueConfigure(struct table_data *data, unsigned int capacity, int low_watermark,
+    int high_watermark);
 void QueueUpdate(struct table_data *data, int point_number);
+int QueueCount(struct table_data *data);
 int QueueGet(struct table_data *data_in, struct table_data_read *data_out,
     int offset);
 int QueueLast(struct table_data *data_in, struct table_data_read *data_out);
@@ -52,7 +112,14 @@ int QueueFill(struct table_data *data);
 int QueuePut(struct table_data *data, int line_number);
 int QueuePutPipe(struct table_data *data, int line_number);
 float FileCompleteGet(int nodeId, int point_in_table);
+long FileLineCount(int nodeId);
+void FileIndexPrepare(int nodeId);
+int FileValidate(struct table_data *data, int table_num, unsigned long *total_time_ms);
 int QueueOpenFile(struct table_data *data);
+void QueueCloseFile(struct table_data *data);
+int QueueMapFile(struct table_data *data);
+int QueueOpenBinary(struct table_data *data);
 int QueueSeek(struct table_data *data, int point_number);
+int QueueSeekTime(struct table_data *data);
 
 #endif /* FILE_PARSER_H_ */
@@ -0,0 +1,182 @@
+/*
+ * interp_feeder.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * I punti venivano inviati dal thread di ricezione di CanFestival, lo stesso
+ * che esegue le macchine a stati SDO e stampa lo stato dei motori: una printf
+ * lenta ritardava il riempimento della FIFO dell'interpolatore. Le callback
+ * CAN ora si limitano a segnalare a questo thread che lo stato
+ * dell'interpolatore (posti liberi e bit di stato) è cambiato o che la FIFO
+ * va rabboccata; il thread, con priorità SCHED_FIFO, è l'unico ad inviare i
+ * punti. Le segnalazioni per lo stesso motore non ancora servite vengono
+ * sostituite dall'ultima.
+ *
+ * Il numero di punti da inviare non viene passato dalle callback: lo calcola
+ * la funzione di invio al momento dell'invio, quando i punti inviati in
+ * precedenza sono già stati registrati (vedi fifo_control_demand). Un
+ * conteggio calcolato nella callback mentre il thread sta ancora inviando i
+ * punti precedenti riempirebbe due volte gli stessi posti.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "interp_feeder.h"
+#include "CANOpenShellStateMachine.h"
+
+/**
+ * Richiesta in attesa per un motore.
+ */
+struct interp_feeder_request
+{
+  int pending; /**< la richiesta non è ancora stata servita */
+  UNS16 interp_status; /**< ultimo stato dell'interpolatore */
+};
+
+static struct interp_feeder_request feeder_request[CANOPEN_NODE_NUMBER];
+static pthread_mutex_t feeder_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t feeder_wake = PTHREAD_COND_INITIALIZER;
+static pthread_t feeder_thread;
+static int feeder_running = 0;
+static int feeder_pending = 0; /**< numero di richieste in attesa */
+static interp_feeder_t feeder_function;
+
+static void *interp_feeder(void *args)
+{
+  struct interp_feeder_request request[CANOPEN_NODE_NUMBER];
+  int nodeid;
+
+  pthread_mutex_lock(&feeder_mutex);
+
+  while(feeder_running)
+  {
+    if(feeder_pending == 0)
+    {
+      pthread_cond_wait(&feeder_wake, &feeder_mutex);
+      continue;
+    }
+
+    // prendo tutte le richieste e le servo senza tenere il mutex, così le
+    // callback non restano mai in attesa del thread
+    memcpy(request, feeder_request, sizeof(request));
+
+    for(nodeid = 0; nodeid < CANOPEN_NODE_NUMBER; nodeid++)
+      feeder_request[nodeid].pending = 0;
+
+    feeder_pending = 0;
+
+    pthread_mutex_unlock(&feeder_mutex);
+
+    for(nodeid = 0; nodeid < CANOPEN_NODE_NUMBER; nodeid++)
+    {
+      if(request[nodeid].pending)
+        feeder_function(nodeid, request[nodeid].interp_status);
+    }
+
+    pthread_mutex_lock(&feeder_mutex);
+  }
+
+  pthread_mutex_unlock(&feeder_mutex);
+
+  return NULL;
+}
+
+/**
+ * Avvia il thread.
+ *
+ * @input feed: funzione che invia i punti al motore
+ * @input priority: priorità SCHED_FIFO del thread
+ *
+ * @return:  0 -> thread avviato
+ *          -1 -> impossibile creare il thread
+ *
+ * @remark: se il processo non ha i permessi per la priorità real-time, il
+ * thread viene avviato con la priorità normale.
+ */
+int interp_feeder_start(interp_feeder_t feed, int priority)
+{
+  pthread_attr_t attr;
+  struct sched_param param;
+  int err;
+
+  if(feeder_running)
+    return 0;
+
+  feeder_function = feed;
+  feeder_running = 1;
+
+  pthread_attr_init(&attr);
+  pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+  pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+  memset(&param, 0, sizeof(param));
+  param.sched_priority = priority;
+  pthread_attr_setschedparam(&attr, &param);
+
+  err = pthread_create(&feeder_thread, &attr, interp_feeder, NULL);
+
+  pthread_attr_destroy(&attr);
+
+  if(err != 0)
+  {
+    printf("WARN: real-time priority not available for the interpolation thread (%s)\n",
+        strerror(err));
+
+    err = pthread_create(&feeder_thread, NULL, interp_feeder, NULL);
+  }
+
+  if(err != 0)
+  {
+    printf("can't create thread:[%s]", strerror(err));
+    feeder_running = 0;
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * Ferma il thread ed attende che abbia finito l'invio in corso.
+ */
+void interp_feeder_stop(void)
+{
+  pthread_mutex_lock(&feeder_mutex);
+
+  if(!feeder_running)
+  {
+    pthread_mutex_unlock(&feeder_mutex);
+    return;
+  }
+
+  feeder_running = 0;
+  pthread_cond_signal(&feeder_wake);
+  pthread_mutex_unlock(&feeder_mutex);
+
+  pthread_join(feeder_thread, NULL);
+}
+
+/**
+ * Segnala al thread che al motore potrebbero servire dei punti.
+ *
+ * @input nodeid: indirizzo del motore
+ * @input interp_status: stato dell'interpolatore
+ *
+ * @remark: può essere chiamata dalle callback CAN, non attende mai l'invio.
+ */
+void interp_feeder_post(UNS8 nodeid, UNS16 interp_status)
+{
+  if(nodeid >= CANOPEN_NODE_NUMBER)
+    return;
+
+  pthread_mutex_lock(&feeder_mutex);
+
+  if(!feeder_request[nodeid].pending)
+    feeder_pending++;
+
+  feeder_request[nodeid].pending = 1;
+  feeder_request[nodeid].interp_status = interp_status;
+
+  pthread_cond_signal(&feeder_wake);
+  pthread_mutex_unlock(&feeder_mutex);
+}
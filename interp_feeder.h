@@ -0,0 +1,27 @@
+/*
+ * interp_feeder.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Thread dedicato all'invio dei punti di interpolazione.
+ */
+
+#ifndef INTERP_FEEDER_H_
+#define INTERP_FEEDER_H_
+
+#include "canfestival.h"
+
+#define INTERP_FEEDER_PRIORITY 80 // priorità SCHED_FIFO del thread
+
+/**
+ * Funzione chiamata dal thread per inviare i punti ad un motore: calcola lei
+ * quanti punti inviare.
+ */
+typedef void (*interp_feeder_t)(UNS8 nodeid, UNS16 interp_status);
+
+int interp_feeder_start(interp_feeder_t feed, int priority);
+void interp_feeder_stop(void);
+void interp_feeder_post(UNS8 nodeid, UNS16 interp_status);
+
+#endif /* INTERP_FEEDER_H_ */
@@ -0,0 +1,268 @@
+/*
+ * interp_pdo.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * I punti di interpolazione passavano dalle variabili del dizionario del
+ * master (InterpolationData, InterpolationTimeValue, InterpolationTimePeriod)
+ * e da sendPDOevent, forzando la ritrasmissione con l'azzeramento di
+ * PDO_status[].last_message.cob_id: tutti i motori condividevano le stesse
+ * variabili e lo stesso percorso. Qui i frame vengono composti direttamente
+ * per il singolo motore, con lo stato di ogni motore separato dagli altri,
+ * quindi più motori possono trasmettere i punti da thread diversi senza
+ * toccare il dizionario. I COB-ID vengono ricavati dall'indirizzo del motore,
+ * per cui il numero di motori non è legato al numero di PDO del master.
+ */
+#include <string.h>
+#include <pthread.h>
+#include "interp_pdo.h"
+#include "CANOpenShellStateMachine.h"
+
+/**
+ * Stato della trasmissione per un motore.
+ */
+struct interp_pdo_node
+{
+  CAN_PORT port; /**< porta CAN su cui trasmettere */
+  UNS16 time_cob_id; /**< COB-ID del PDO del tempo (periodo e valore), 0 se non inizializzato */
+  UNS16 target_cob_id; /**< COB-ID del PDO della posizione di arrivo (modo posizione) */
+  UNS16 data_cob_id; /**< COB-ID del PDO della posizione */
+  UNS8 last_time[2]; /**< ultimo tempo trasmesso */
+  int last_time_valid; /**< last_time contiene un tempo già trasmesso */
+  pthread_mutex_t mutex; /**< serializza i thread che trasmettono allo stesso motore */
+};
+
+static struct interp_pdo_node interp_node[CANOPEN_NODE_NUMBER];
+static pthread_once_t interp_once = PTHREAD_ONCE_INIT;
+
+static void interp_mutex_init(void)
+{
+  int i;
+
+  for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
+    pthread_mutex_init(&interp_node[i].mutex, NULL);
+}
+
+/**
+ * Prepara la trasmissione dei punti verso un motore.
+ *
+ * @input port: porta CAN su cui trasmettere
+ * @input nodeid: indirizzo del motore
+ *
+ * @return:  0 -> motore pronto
+ *          -1 -> indirizzo non valido
+ *
+ * @remark: i COB-ID sono quelli configurati nel motore da ConfigureSlaveNode,
+ * quindi non dipendono dai PDO del dizionario del master né dal numero di
+ * motori. Va chiamata prima di ogni tabella, in quanto dimentica l'ultimo tempo
+ * trasmesso: il primo punto trasmette sempre anche il tempo.
+ */
+int interp_init(CAN_PORT port, UNS8 nodeid)
+{
+  struct interp_pdo_node *node;
+
+  if((nodeid == 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return -1;
+
+  pthread_once(&interp_once, interp_mutex_init);
+
+  node = &interp_node[nodeid];
+
+  pthread_mutex_lock(&node->mutex);
+  node->port = port;
+  node->time_cob_id = INTERP_PDO_TIME_COB_ID + nodeid;
+  node->target_cob_id = INTERP_PDO_TARGET_COB_ID + nodeid;
+  node->data_cob_id = INTERP_PDO_DATA_COB_ID + nodeid;
+  node->last_time_valid = 0;
+  pthread_mutex_unlock(&node->mutex);
+
+  return 0;
+}
+
+/**
+ * Accoda il frame del tempo se diverso dall'ultimo trasmesso.
+ */
+static void interp_time_add(struct interp_pdo_node *node, UNS8 time_value, INTEGER8 time_period,
+    Message *burst, int *frame_count)
+{
+  Message *frame;
+
+  if(node->last_time_valid && (node->last_time[0] == (UNS8) time_period)
+      && (node->last_time[1] == time_value))
+    return;
+
+  frame = &burst[(*frame_count)++];
+  frame->cob_id = node->time_cob_id;
+  frame->rtr = 0;
+  frame->len = 2;
+  frame->data[0] = (UNS8) time_period;
+  frame->data[1] = time_value;
+
+  node->last_time[0] = frame->data[0];
+  node->last_time[1] = frame->data[1];
+  node->last_time_valid = 1;
+}
+
+/**
+ * Accoda i frame di un punto: il tempo solo se diverso dall'ultimo
+ * trasmesso, la posizione sempre.
+ */
+static void interp_frame_add(struct interp_pdo_node *node, const struct interp_point *point,
+    Message *burst, int *frame_count)
+{
+  Message *frame;
+
+  interp_time_add(node, point->time_value, point->time_period, burst, frame_count);
+
+  // INTEGER32 little endian
+  frame = &burst[(*frame_count)++];
+  frame->cob_id = node->data_cob_id;
+  frame->rtr = 0;
+  frame->len = 4;
+  frame->data[0] = (UNS8) (point->position & 0xFF);
+  frame->data[1] = (UNS8) ((point->position >> 8) & 0xFF);
+  frame->data[2] = (UNS8) ((point->position >> 16) & 0xFF);
+  frame->data[3] = (UNS8) ((point->position >> 24) & 0xFF);
+}
+
+/**
+ * Passa al driver CAN i frame accodati.
+ *
+ * @return: numero di frame non trasmessi
+ */
+static int interp_flush(struct interp_pdo_node *node, Message *burst, int *frame_count)
+{
+  int i;
+  int send_error = 0;
+
+  for(i = 0; i < *frame_count; i++)
+  {
+    if(canSend(node->port, &burst[i]) != 0)
+      send_error++;
+  }
+
+  *frame_count = 0;
+
+  return send_error;
+}
+
+/**
+ * Restituisce lo stato del motore bloccandone il mutex, NULL se il motore
+ * non è stato inizializzato con interp_init.
+ */
+static struct interp_pdo_node *interp_node_lock(UNS8 nodeid)
+{
+  struct interp_pdo_node *node;
+
+  if(nodeid >= CANOPEN_NODE_NUMBER)
+    return NULL;
+
+  pthread_once(&interp_once, interp_mutex_init);
+
+  node = &interp_node[nodeid];
+
+  pthread_mutex_lock(&node->mutex);
+
+  if(node->time_cob_id == 0)
+  {
+    pthread_mutex_unlock(&node->mutex);
+    return NULL;
+  }
+
+  return node;
+}
+
+/**
+ * Trasmette al motore una serie di punti in un'unica passata.
+ *
+ * @input nodeid: indirizzo del motore
+ * @input point: punti da trasmettere
+ * @input point_count: numero di punti
+ *
+ * @return: >= 0 -> numero di frame non trasmessi
+ *            -1 -> motore non inizializzato con interp_init
+ */
+int interp_send_burst(UNS8 nodeid, const struct interp_point *point, int point_count)
+{
+  struct interp_pdo_node *node;
+  Message burst[INTERP_PDO_BURST_FRAMES];
+  int frame_count = 0;
+  int send_error = 0;
+  int i;
+
+  node = interp_node_lock(nodeid);
+
+  if(node == NULL)
+    return -1;
+
+  for(i = 0; i < point_count; i++)
+  {
+    // servono al più due frame per punto
+    if(frame_count > INTERP_PDO_BURST_FRAMES - 2)
+      send_error += interp_flush(node, burst, &frame_count);
+
+    interp_frame_add(node, &point[i], burst, &frame_count);
+  }
+
+  send_error += interp_flush(node, burst, &frame_count);
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return send_error;
+}
+
+/**
+ * Trasmette un punto al motore.
+ *
+ * @return: vedi interp_send_burst
+ */
+int interp_send(UNS8 nodeid, long position, UNS8 time_value, INTEGER8 time_period)
+{
+  struct interp_point point;
+
+  point.position = position;
+  point.time_value = time_value;
+  point.time_period = time_period;
+
+  return interp_send_burst(nodeid, &point, 1);
+}
+
+/**
+ * Trasmette al motore la posizione di arrivo con la velocità del profilo
+ * (modo posizione).
+ *
+ * @return:  0 -> frame trasmesso
+ *           1 -> frame non trasmesso
+ *          -1 -> motore non inizializzato con interp_init
+ */
+int interp_send_target(UNS8 nodeid, unsigned long velocity, long position)
+{
+  struct interp_pdo_node *node;
+  Message frame;
+  int send_error;
+
+  node = interp_node_lock(nodeid);
+
+  if(node == NULL)
+    return -1;
+
+  // UNS32 e INTEGER32 little endian
+  frame.cob_id = node->target_cob_id;
+  frame.rtr = 0;
+  frame.len = 8;
+  frame.data[0] = (UNS8) (velocity & 0xFF);
+  frame.data[1] = (UNS8) ((velocity >> 8) & 0xFF);
+  frame.data[2] = (UNS8) ((velocity >> 16) & 0xFF);
+  frame.data[3] = (UNS8) ((velocity >> 24) & 0xFF);
+  frame.data[4] = (UNS8) (position & 0xFF);
+  frame.data[5] = (UNS8) ((position >> 8) & 0xFF);
+  frame.data[6] = (UNS8) ((position >> 16) & 0xFF);
+  frame.data[7] = (UNS8) ((position >> 24) & 0xFF);
+
+  send_error = (canSend(node->port, &frame) != 0) ? 1 : 0;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return send_error;
+}
@@ -0,0 +1,38 @@
+/*
+ * interp_pdo.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Trasmissione diretta dei punti di interpolazione ai motori.
+ */
+
+#ifndef INTERP_PDO_H_
+#define INTERP_PDO_H_
+
+#include "canfestival.h"
+
+#define INTERP_PDO_BURST_FRAMES 64 // frame raccolti prima di passarli al driver CAN
+
+// COB-ID dei PDO di ricezione del motore (vedi ConfigureSlaveNode), da sommare
+// all'indirizzo del motore
+#define INTERP_PDO_TIME_COB_ID 0x200 // RPDO1: periodo e valore del tempo (0x60c2)
+#define INTERP_PDO_TARGET_COB_ID 0x300 // RPDO2: velocità (0x6081) e posizione (0x607a)
+#define INTERP_PDO_DATA_COB_ID 0x400 // RPDO3: posizione da interpolare (0x60c1)
+
+/**
+ * Punto da trasmettere all'interpolatore del motore.
+ */
+struct interp_point
+{
+  long position; /**< posizione da raggiungere in passi encoder */
+  UNS8 time_value; /**< tempo codificato per l'interpolatore: unità */
+  INTEGER8 time_period; /**< tempo codificato per l'interpolatore: esponente */
+};
+
+int interp_init(CAN_PORT port, UNS8 nodeid);
+int interp_send(UNS8 nodeid, long position, UNS8 time_value, INTEGER8 time_period);
+int interp_send_burst(UNS8 nodeid, const struct interp_point *point, int point_count);
+int interp_send_target(UNS8 nodeid, unsigned long velocity, long position);
+
+#endif /* INTERP_PDO_H_ */
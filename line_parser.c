@@ -0,0 +1,217 @@
+/*
+ * line_parser.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Analisi delle righe dei file tabella (.mot). Il modulo non dipende dallo
+ * stack canopen, in modo da poter essere usato anche dagli strumenti di
+ * conversione.
+ */
+#include <string.h>
+#include "line_parser.h"
+
+/**
+ * Legge un intero con segno a partire da *cursor, senza superare end.
+ *
+ * @return: 0 se il numero è valido, -1 altrimenti
+ *
+ * @remark: in entrambi i casi *cursor viene spostato sul primo carattere non
+ * letto, in modo da poter indicare la colonna esatta dell'errore. Il numero
+ * deve terminare con uno spazio o con la fine della riga.
+ */
+static int ParseLong(const char **cursor, const char *end, long *value)
+{
+  const char *digits;
+  const char *current = *cursor;
+  long result = 0;
+  int negative = 0;
+
+  if((current < end) && ((*current == '-') || (*current == '+')))
+  {
+    negative = (*current == '-');
+    current++;
+  }
+
+  digits = current;
+
+  while((current < end) && (*current >= '0') && (*current <= '9'))
+  {
+    // il valore deve stare in 32 bit con segno
+    if((result > (LINE_NUMBER_MAX / 10))
+        || ((result == (LINE_NUMBER_MAX / 10)) && ((*current - '0') > (LINE_NUMBER_MAX % 10))))
+      break;
+
+    result = (result * 10) + (*current - '0');
+    current++;
+  }
+
+  *cursor = current;
+
+  if((current == digits) || ((current < end) && (*current != ' ')))
+    return -1;
+
+  *value = negative ? -result : result;
+
+  return 0;
+}
+
+/**
+ * Verifica che in *cursor sia presente la chiave indicata e la salta.
+ */
+static int ParseKey(const char **cursor, const char *end, const char *key)
+{
+  const char *current = *cursor;
+
+  while(*key != '\0')
+  {
+    if((current == end) || (*current != *key))
+    {
+      *cursor = current;
+      return -1;
+    }
+
+    current++;
+    key++;
+  }
+
+  *cursor = current;
+
+  return 0;
+}
+
+static const char *SkipSpaces(const char *cursor, const char *end)
+{
+  while((cursor < end) && (*cursor == ' '))
+    cursor++;
+
+  return cursor;
+}
+
+/**
+ * Analizza una riga del file tabella in un solo passaggio, senza copiarla.
+ *
+ * @input line: inizio della riga
+ * @input end: fine della riga (il "\n" finale può essere incluso)
+ * @output record: campi letti; in caso di errore record->column indica la
+ *                 colonna (a partire da 1) in cui l'analisi si è fermata
+ *
+ * @return: LINE_OK, LINE_EMPTY oppure uno dei codici di errore LINE_ERR_*
+ *
+ * @remark: le righe ammesse sono
+ *    "CT1 M<id> S<pos> T<ms>"               riga tabella
+ *    "CT1 M<id> H<offset> VF<vel> VB<vel>"  riga di homing
+ *    "CT1 M<id> P<pos> VM<vel> AM<acc> [<start>]" riga di posizione (pipe)
+ */
+int LineParse(const char *line, const char *end, struct line_record *record)
+{
+  const char *cursor = line;
+  long value;
+  int result = LINE_OK;
+
+  while((end > line) && ((*(end - 1) == '\n') || (*(end - 1) == '\r') || (*(end - 1) == '\a')))
+    end--;
+
+  record->column = 0;
+  record->start_flag = 0;
+
+  if(end == line)
+    return LINE_EMPTY;
+
+  if(ParseKey(&cursor, end, "CT1 M") < 0)
+  {
+    result = LINE_ERR_HEADER;
+    goto fault;
+  }
+
+  if(ParseLong(&cursor, end, &value) < 0)
+  {
+    result = LINE_ERR_NODEID;
+    goto fault;
+  }
+
+  record->nodeid = value;
+
+  cursor = SkipSpaces(cursor, end);
+  if(cursor == end)
+  {
+    result = LINE_ERR_TYPE;
+    goto fault;
+  }
+
+  record->type = *cursor++;
+
+  result = LINE_ERR_FIELD;
+
+  if(ParseLong(&cursor, end, &record->position) < 0)
+    goto fault;
+
+  cursor = SkipSpaces(cursor, end);
+
+  switch(record->type)
+  {
+    case 'S':
+      if(ParseKey(&cursor, end, "T") < 0)
+        goto fault;
+
+      if((ParseLong(&cursor, end, &record->time_ms) < 0) || (record->time_ms <= 0)
+          || (record->time_ms > LINE_TIME_MAX))
+        goto fault;
+
+      break;
+
+    case 'H':
+      if((ParseKey(&cursor, end, "VF") < 0)
+          || (ParseLong(&cursor, end, &record->forward_velocity) < 0))
+        goto fault;
+
+      cursor = SkipSpaces(cursor, end);
+
+      if((ParseKey(&cursor, end, "VB") < 0)
+          || (ParseLong(&cursor, end, &record->backward_velocity) < 0))
+        goto fault;
+
+      break;
+
+    case 'P':
+      if((ParseKey(&cursor, end, "VM") < 0)
+          || (ParseLong(&cursor, end, &record->velocity) < 0))
+        goto fault;
+
+      cursor = SkipSpaces(cursor, end);
+
+      if((ParseKey(&cursor, end, "AM") < 0)
+          || (ParseLong(&cursor, end, &record->acceleration) < 0))
+        goto fault;
+
+      cursor = SkipSpaces(cursor, end);
+
+      // il flag di start è facoltativo
+      if(cursor != end)
+      {
+        if(ParseLong(&cursor, end, &value) < 0)
+          goto fault;
+
+        record->start_flag = value;
+      }
+
+      break;
+
+    default:
+      cursor--;
+      goto fault;
+  }
+
+  cursor = SkipSpaces(cursor, end);
+
+  if(cursor != end)
+    goto fault;
+
+  return LINE_OK;
+
+  fault:
+
+  record->column = (cursor - line) + 1;
+
+  return result;
+}
@@ -0,0 +1,40 @@
+/*
+ * line_parser.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ */
+
+#ifndef LINE_PARSER_H_
+#define LINE_PARSER_H_
+
+#define LINE_EMPTY 1
+#define LINE_OK 0
+#define LINE_ERR_HEADER -1 /**< la riga non inizia con "CT1 M" */
+#define LINE_ERR_NODEID -2 /**< indirizzo del motore mancante */
+#define LINE_ERR_TYPE -3 /**< tipo di riga mancante */
+#define LINE_ERR_FIELD -4 /**< parametri della riga non validi */
+
+#define LINE_NUMBER_MAX 2147483647L // valore massimo accettato per un campo numerico
+#define LINE_TIME_MAX 65535L // tempo massimo di un punto della tabella in ms (16 bit)
+
+/**
+ * Campi di una riga del file tabella.
+ */
+struct line_record
+{
+  int nodeid;
+  char type; /**< "H": riga di homing, "S": riga tabella */
+  long position; /**< posizione (riga "S") oppure offset dal limite di giunto (riga "H") */
+  long time_ms;
+  long forward_velocity;
+  long backward_velocity;
+  long velocity; /**< velocità massima (riga "P") */
+  long acceleration; /**< accelerazione massima (riga "P") */
+  int start_flag; /**< comando di start (riga "P") */
+  int column; /**< colonna in cui è stato trovato l'errore */
+};
+
+int LineParse(const char *line, const char *end, struct line_record *record);
+
+#endif /* LINE_PARSER_H_ */
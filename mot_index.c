@@ -0,0 +1,343 @@
+/*
+ * mot_index.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Per conoscere il numero di righe di un file tabella bisognerebbe leggerlo
+ * tutto ad ogni avvio della simulazione. L'indice raccoglie una volta sola
+ * le informazioni sul file (righe, punti, prima ed ultima posizione, durata,
+ * righe non valide) ed una serie di checkpoint con lo spostamento in byte di
+ * un punto ogni MOT_INDEX_CHECKPOINT_STEP, e viene salvato in <file>.idx.
+ * Finché il file di testo non cambia (dimensione e data di modifica),
+ * l'indice viene riletto invece di ricostruirlo, e con lui il risultato della
+ * validazione del file.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "mot_index.h"
+#include "line_parser.h"
+
+/**
+ * Verifica che il file di testo corrisponda a quello indicizzato.
+ */
+static int MotIndexMatch(const struct stat *source_stat, const struct mot_index_header *header)
+{
+  return (header->source_size == (uint64_t) source_stat->st_size)
+      && (header->source_mtime_sec == (int64_t) source_stat->st_mtim.tv_sec)
+      && (header->source_mtime_nsec == (int64_t) source_stat->st_mtim.tv_nsec);
+}
+
+/**
+ * Legge l'indice salvato accanto al file di testo.
+ *
+ * @input source_path: file .mot indicizzato
+ * @input nodeid: indirizzo del motore atteso
+ * @output index: indice letto, da liberare con MotIndexFree
+ *
+ * @return:  0 -> indice valido
+ *          -1 -> indice o file di testo non presenti
+ *          -2 -> indice non valido o non aggiornato
+ */
+int MotIndexLoad(const char *source_path, int nodeid, struct mot_index *index)
+{
+  char index_path[512];
+  struct stat source_stat;
+  FILE *file;
+  size_t checkpoint_size;
+
+  index->checkpoint = NULL;
+
+  if(stat(source_path, &source_stat) != 0)
+    return -1;
+
+  snprintf(index_path, sizeof(index_path), "%s%s", source_path, MOT_INDEX_EXTENSION);
+
+  file = fopen(index_path, "r");
+
+  if(file == NULL)
+    return -1;
+
+  if((fread(&index->header, sizeof(index->header), 1, file) != 1)
+      || (index->header.magic != MOT_INDEX_MAGIC) || (index->header.version != MOT_INDEX_VERSION)
+      || (index->header.node_id != nodeid) || (index->header.checkpoint_step == 0)
+      || !MotIndexMatch(&source_stat, &index->header))
+  {
+    fclose(file);
+    return -2;
+  }
+
+  checkpoint_size = index->header.checkpoint_count * sizeof(index->checkpoint[0]);
+
+  if(checkpoint_size > 0)
+  {
+    index->checkpoint = malloc(checkpoint_size);
+
+    if((index->checkpoint == NULL)
+        || (fread(index->checkpoint, checkpoint_size, 1, file) != 1))
+    {
+      MotIndexFree(index);
+      fclose(file);
+      return -2;
+    }
+  }
+
+  fclose(file);
+
+  return 0;
+}
+
+/**
+ * Controlla una riga del file con le stesse regole del riempitore di tabella.
+ *
+ * @return: LINE_OK o LINE_EMPTY se la riga è valida, altrimenti il codice di
+ * errore e la colonna in record->column
+ *
+ * @remark: la riga di homing è ammessa solo come prima riga del file.
+ */
+static int MotIndexLineCheck(const char *line, const char *end, int nodeid, uint32_t line_count,
+    struct line_record *record)
+{
+  int line_status = LineParse(line, end, record);
+
+  if((line_status == LINE_EMPTY) || (line_status == LINE_ERR_HEADER)
+      || (line_status == LINE_ERR_NODEID))
+    return line_status;
+
+  if(record->nodeid != nodeid)
+  {
+    record->column = 6;
+    return LINE_ERR_NODEID;
+  }
+
+  if(line_status != LINE_OK)
+    return line_status;
+
+  if(((record->type == 'H') && (line_count != 0)) || ((record->type != 'H') && (record->type != 'S')))
+  {
+    record->column = 1;
+    return LINE_ERR_FIELD;
+  }
+
+  return LINE_OK;
+}
+
+/**
+ * Salva l'indice accanto al file di testo.
+ *
+ * @remark: l'indice viene scritto in un file temporaneo e poi rinominato,
+ * quindi chi lo legge non può trovarlo a metà anche se due thread lo
+ * costruiscono insieme.
+ */
+static int MotIndexSave(const char *source_path, const struct mot_index *index)
+{
+  char index_path[512];
+  char temp_path[520];
+  FILE *file;
+  int fd;
+  int result = 0;
+
+  snprintf(index_path, sizeof(index_path), "%s%s", source_path, MOT_INDEX_EXTENSION);
+  snprintf(temp_path, sizeof(temp_path), "%s.XXXXXX", index_path);
+
+  fd = mkstemp(temp_path);
+
+  if(fd < 0)
+    return -1;
+
+  // mkstemp crea il file leggibile solo dal proprietario
+  fchmod(fd, 0644);
+
+  file = fdopen(fd, "w");
+
+  if(file == NULL)
+  {
+    close(fd);
+    remove(temp_path);
+    return -1;
+  }
+
+  if(fwrite(&index->header, sizeof(index->header), 1, file) != 1)
+    result = -1;
+
+  if((result == 0) && (index->header.checkpoint_count > 0)
+      && (fwrite(index->checkpoint, sizeof(index->checkpoint[0]), index->header.checkpoint_count,
+          file) != index->header.checkpoint_count))
+    result = -1;
+
+  if(fclose(file) != 0)
+    result = -1;
+
+  if((result == 0) && (rename(temp_path, index_path) != 0))
+    result = -1;
+
+  if(result != 0)
+    remove(temp_path);
+
+  return result;
+}
+
+/**
+ * Costruisce l'indice leggendo tutto il file di testo e prova a salvarlo.
+ *
+ * @input source_path: file .mot da indicizzare
+ * @input nodeid: indirizzo del motore
+ * @output index: indice costruito, da liberare con MotIndexFree
+ *
+ * @return:  0 -> indice costruito
+ *          -1 -> errore nella lettura del file o memoria esaurita
+ *
+ * @remark: le righe non valide non diventano punti, ma vengono contate e la
+ * prima viene salvata nell'indice (vedi FileValidate). Se il salvataggio
+ * fallisce (es. directory in sola lettura) l'indice resta comunque valido in
+ * memoria. Se il file cambia durante la lettura, l'indice non viene salvato.
+ */
+int MotIndexBuild(const char *source_path, int nodeid, struct mot_index *index)
+{
+  FILE *file;
+  char *line = NULL;
+  size_t len = 0;
+  ssize_t read;
+  struct stat source_stat;
+  struct stat source_stat_end;
+  struct line_record record;
+  struct mot_index_checkpoint *checkpoint;
+  uint32_t checkpoint_max = 0;
+  uint64_t byte_offset = 0;
+  int line_status;
+
+  index->checkpoint = NULL;
+  memset(&index->header, 0, sizeof(index->header));
+
+  file = fopen(source_path, "r");
+
+  if(file == NULL)
+    return -1;
+
+  if(fstat(fileno(file), &source_stat) != 0)
+  {
+    fclose(file);
+    return -1;
+  }
+
+  index->header.magic = MOT_INDEX_MAGIC;
+  index->header.version = MOT_INDEX_VERSION;
+  index->header.node_id = nodeid;
+  index->header.source_size = source_stat.st_size;
+  index->header.source_mtime_sec = source_stat.st_mtim.tv_sec;
+  index->header.source_mtime_nsec = source_stat.st_mtim.tv_nsec;
+  index->header.checkpoint_step = MOT_INDEX_CHECKPOINT_STEP;
+
+  while((read = getline(&line, &len, file)) != -1)
+  {
+    line_status = MotIndexLineCheck(line, line + read - ((line[read - 1] == '\n') ? 1 : 0), nodeid,
+        index->header.line_count, &record);
+
+    if((line_status != LINE_OK) && (line_status != LINE_EMPTY))
+    {
+      if(index->header.error_count == 0)
+      {
+        index->header.error_line = index->header.line_count + 1;
+        index->header.error_column = record.column;
+      }
+
+      index->header.error_count++;
+    }
+    else if((line_status == LINE_OK) && (record.type == 'S'))
+    {
+      if((index->header.point_count % MOT_INDEX_CHECKPOINT_STEP) == 0)
+      {
+        if(index->header.checkpoint_count == checkpoint_max)
+        {
+          checkpoint_max = (checkpoint_max == 0) ? 64 : checkpoint_max * 2;
+          checkpoint = realloc(index->checkpoint, checkpoint_max * sizeof(checkpoint[0]));
+
+          if(checkpoint == NULL)
+          {
+            free(line);
+            fclose(file);
+            MotIndexFree(index);
+            return -1;
+          }
+
+          index->checkpoint = checkpoint;
+        }
+
+        checkpoint = &index->checkpoint[index->header.checkpoint_count++];
+        checkpoint->byte_offset = byte_offset;
+        checkpoint->time_ms = index->header.total_time_ms;
+        checkpoint->line = index->header.line_count;
+        checkpoint->point = index->header.point_count;
+      }
+
+      if(index->header.point_count == 0)
+        index->header.first_position = record.position;
+
+      index->header.last_position = record.position;
+      index->header.total_time_ms += record.time_ms;
+      index->header.point_count++;
+    }
+
+    index->header.line_count++;
+    byte_offset += read;
+  }
+
+  free(line);
+  fclose(file);
+
+  if((stat(source_path, &source_stat_end) == 0) && MotIndexMatch(&source_stat_end, &index->header))
+    MotIndexSave(source_path, index);
+
+  return 0;
+}
+
+/**
+ * Restituisce l'indice del file, costruendolo se manca o non è aggiornato.
+ */
+int MotIndexGet(const char *source_path, int nodeid, struct mot_index *index)
+{
+  if(MotIndexLoad(source_path, nodeid, index) == 0)
+    return 0;
+
+  return MotIndexBuild(source_path, nodeid, index);
+}
+
+void MotIndexFree(struct mot_index *index)
+{
+  free(index->checkpoint);
+  index->checkpoint = NULL;
+}
+
+/**
+ * Cerca l'ultimo checkpoint che non supera l'istante indicato.
+ *
+ * @return: il checkpoint trovato, NULL se la tabella non contiene punti
+ *
+ * @remark: i checkpoint sono ordinati per tempo, quindi la ricerca è binaria.
+ */
+const struct mot_index_checkpoint *MotIndexCheckpointFind(const struct mot_index *index,
+    uint64_t time_ms)
+{
+  uint32_t low = 0;
+  uint32_t high = index->header.checkpoint_count;
+  uint32_t middle;
+
+  if(high == 0)
+    return NULL;
+
+  // checkpoint[low].time_ms <= time_ms < checkpoint[high].time_ms
+  while(high - low > 1)
+  {
+    middle = low + (high - low) / 2;
+
+    if(index->checkpoint[middle].time_ms <= time_ms)
+      low = middle;
+    else
+      high = middle;
+  }
+
+  return &index->checkpoint[low];
+}
@@ -0,0 +1,71 @@
+/*
+ * mot_index.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Indice dei file tabella (.mot.idx), salvato accanto al file di testo.
+ */
+
+#ifndef MOT_INDEX_H_
+#define MOT_INDEX_H_
+
+#include <stdint.h>
+
+#define MOT_INDEX_MAGIC 0x58444E49 // "INDX" letto in little endian
+#define MOT_INDEX_VERSION 3
+#define MOT_INDEX_EXTENSION ".idx"
+#define MOT_INDEX_CHECKPOINT_STEP 1024 // punti tra due checkpoint consecutivi
+
+/**
+ * Intestazione dell'indice.
+ *
+ * @remark: l'indice è valido solo se dimensione e data di modifica del file
+ * di testo corrispondono a quelle salvate; in caso contrario viene ricostruito.
+ */
+struct mot_index_header
+{
+  uint32_t magic; /**< MOT_INDEX_MAGIC */
+  uint16_t version; /**< MOT_INDEX_VERSION */
+  uint16_t node_id; /**< indirizzo del motore */
+  uint64_t source_size; /**< dimensione del file di testo */
+  int64_t source_mtime_sec; /**< data di modifica del file di testo */
+  int64_t source_mtime_nsec;
+  uint32_t line_count; /**< righe del file, compresa quella di homing */
+  uint32_t point_count; /**< punti della tabella (righe "S") */
+  int32_t first_position; /**< posizione del primo punto */
+  int32_t last_position; /**< posizione dell'ultimo punto */
+  uint64_t total_time_ms; /**< durata complessiva della tabella */
+  uint32_t error_count; /**< righe non valide */
+  uint32_t error_line; /**< prima riga non valida (da 1), 0 se il file è corretto */
+  uint32_t error_column; /**< colonna dell'errore nella prima riga non valida */
+  uint32_t checkpoint_step; /**< MOT_INDEX_CHECKPOINT_STEP al momento della creazione */
+  uint32_t checkpoint_count; /**< numero di checkpoint dopo l'intestazione */
+} __attribute__((packed));
+
+/**
+ * Checkpoint salvato ogni checkpoint_step punti: permette di riposizionarsi
+ * nel file senza doverlo rileggere dall'inizio.
+ */
+struct mot_index_checkpoint
+{
+  uint64_t byte_offset; /**< inizio della riga del punto nel file di testo */
+  uint64_t time_ms; /**< somma dei tempi dei punti precedenti */
+  uint32_t line; /**< righe precedenti il punto */
+  uint32_t point; /**< indice del punto */
+} __attribute__((packed));
+
+struct mot_index
+{
+  struct mot_index_header header;
+  struct mot_index_checkpoint *checkpoint; /**< allocato da MotIndexLoad/MotIndexBuild */
+};
+
+int MotIndexLoad(const char *source_path, int nodeid, struct mot_index *index);
+int MotIndexBuild(const char *source_path, int nodeid, struct mot_index *index);
+int MotIndexGet(const char *source_path, int nodeid, struct mot_index *index);
+void MotIndexFree(struct mot_index *index);
+const struct mot_index_checkpoint *MotIndexCheckpointFind(const struct mot_index *index,
+    uint64_t time_ms);
+
+#endif /* MOT_INDEX_H_ */
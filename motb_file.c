@@ -0,0 +1,296 @@
+/*
+ * motb_file.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * I file .mot vengono convertiti in un formato binario a record fissi (.motb)
+ * in cui il tempo di ogni punto è già codificato per l'interpolatore. In questo
+ * modo il riempitore di tabella non deve più analizzare il testo e
+ * SimulationTableUpdate non deve più convertire il tempo ad ogni punto.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "motb_file.h"
+#include "line_parser.h"
+
+#define MOTB_CHECKSUM_INIT 2166136261u
+#define MOTB_CHECKSUM_PRIME 16777619u
+#define MOTB_READ_CHUNK 256
+#define MOTB_TIME_VALUE_MAX 255 // time_value è di 8 bit
+#define MOTB_TIME_PERIOD_MIN -3 // unità da 1 ms
+#define MOTB_TIME_PERIOD_MAX 0 // unità da 1 s, basta per LINE_TIME_MAX più l'errore recuperato
+
+void MotbTimeEncoderReset(struct motb_time_encoder *encoder)
+{
+  memset(encoder, 0, sizeof(*encoder));
+}
+
+/**
+ * Codifica il tempo in ms nel formato dell'interpolatore SmartMotor.
+ *
+ * @input encoder: stato della codifica della tabella, NULL per codificare il
+ * punto da solo
+ * @input time_ms: tempo del punto
+ * @output time_value: unità di tempo
+ * @output time_period: esponente del tempo
+ *
+ * @return: tempo codificato in ms (time_value * 10^time_period secondi)
+ *
+ * @remark: viene scelto il periodo più piccolo, a partire da 1 ms, in cui il
+ * tempo sta in 8 bit, arrotondando all'unità più vicina: nessun periodo più
+ * grande può avere un errore minore. L'errore viene sommato al tempo del
+ * punto successivo, così la somma dei tempi codificati non si allontana da
+ * quella dei tempi richiesti più di mezza unità dell'ultimo punto, per quanto
+ * lunga sia la tabella, ed i motori con gli stessi tempi restano allineati.
+ * Un tempo nullo resta nullo; un tempo non nullo non viene mai codificato
+ * come nullo.
+ */
+long MotbTimeEncode(struct motb_time_encoder *encoder, long time_ms, uint8_t *time_value,
+    int8_t *time_period)
+{
+  long target = time_ms;
+  long unit = 1;
+  long value;
+
+  *time_period = MOTB_TIME_PERIOD_MIN;
+
+  if(time_ms <= 0)
+  {
+    *time_value = 0;
+    return 0;
+  }
+
+  if(encoder != NULL)
+    target += encoder->residual_ms;
+
+  while((target > MOTB_TIME_VALUE_MAX * unit) && (*time_period < MOTB_TIME_PERIOD_MAX))
+  {
+    unit *= 10;
+    (*time_period)++;
+  }
+
+  value = (target + unit / 2) / unit;
+
+  if(value < 1)
+    value = 1;
+  else if(value > MOTB_TIME_VALUE_MAX)
+    value = MOTB_TIME_VALUE_MAX;
+
+  *time_value = value;
+
+  if(encoder != NULL)
+  {
+    encoder->residual_ms = target - value * unit;
+    encoder->source_ms += time_ms;
+    encoder->encoded_ms += value * unit;
+  }
+
+  return value * unit;
+}
+
+/**
+ * Riporta in ms un tempo codificato con MotbTimeEncode.
+ */
+long MotbTimeDecode(uint8_t time_value, int8_t time_period)
+{
+  long time_ms = time_value;
+  int i;
+
+  for(i = -3; i < time_period; i++)
+    time_ms *= 10;
+
+  return time_ms;
+}
+
+/**
+ * Aggiorna il checksum FNV-1a con i byte passati.
+ */
+uint32_t MotbChecksum(uint32_t checksum, const void *data, size_t size)
+{
+  const uint8_t *byte = data;
+
+  while(size--)
+  {
+    checksum ^= *byte++;
+    checksum *= MOTB_CHECKSUM_PRIME;
+  }
+
+  return checksum;
+}
+
+/**
+ * Legge e verifica l'intestazione di un file .motb.
+ *
+ * @input file: file aperto in lettura
+ * @input nodeid: indirizzo del motore atteso
+ * @output header: intestazione letta
+ *
+ * @return:  0 -> file valido, il cursore è posizionato sul primo record
+ *          -1 -> errore di lettura
+ *          -2 -> intestazione non valida o indirizzo del motore diverso
+ *          -3 -> dimensione o checksum dei record non corrispondenti
+ */
+int MotbHeaderRead(FILE *file, int nodeid, struct motb_header *header)
+{
+  struct motb_record record[MOTB_READ_CHUNK];
+  uint32_t checksum = MOTB_CHECKSUM_INIT;
+  uint32_t record_left;
+  size_t record_read;
+
+  rewind(file);
+
+  if(fread(header, sizeof(*header), 1, file) != 1)
+    return -1;
+
+  if((header->magic != MOTB_MAGIC) || (header->version != MOTB_VERSION)
+      || (header->node_id != nodeid))
+    return -2;
+
+  // verifico tutti i record prima di usarli: un file troncato non deve
+  // lasciare il motore senza punti a metà simulazione
+  record_left = header->point_count;
+
+  while(record_left > 0)
+  {
+    record_read = fread(record, sizeof(record[0]),
+        (record_left < MOTB_READ_CHUNK) ? record_left : MOTB_READ_CHUNK, file);
+
+    if(record_read == 0)
+      return -3;
+
+    checksum = MotbChecksum(checksum, record, record_read * sizeof(record[0]));
+    record_left -= record_read;
+  }
+
+  if((fgetc(file) != EOF) || (checksum != header->checksum))
+    return -3;
+
+  if(fseek(file, sizeof(*header), SEEK_SET) != 0)
+    return -1;
+
+  return 0;
+}
+
+/**
+ * Converte un file .mot nel formato .motb.
+ *
+ * @input source_path: file .mot da convertire
+ * @input destination_path: file .motb da generare
+ * @input nodeid: indirizzo del motore, 0 per prenderlo dalla prima riga
+ * @output header: intestazione del file generato (può essere NULL)
+ *
+ * @return:  0 -> successo
+ *          -1 -> errore nell'apertura o nella scrittura dei file
+ *          >0 -> numero della prima riga non valida
+ *
+ * @remark: il file viene prima scritto con estensione temporanea e poi
+ * rinominato, così il riempitore non può mai trovare un file a metà. Le righe
+ * di homing non sono ammesse, in quanto vengono sempre lette dal file di testo.
+ */
+int MotbConvert(const char *source_path, const char *destination_path, int nodeid,
+    struct motb_header *header)
+{
+  FILE *source;
+  FILE *destination;
+  char temp_path[512];
+  char *line = NULL;
+  size_t len = 0;
+  ssize_t read;
+  long line_number = 0;
+  int line_status;
+  int result = 0;
+
+  struct line_record line_record;
+  struct motb_record record;
+  struct motb_header new_header;
+  struct motb_time_encoder time_encoder;
+
+  source = fopen(source_path, "r");
+
+  if(source == NULL)
+    return -1;
+
+  snprintf(temp_path, sizeof(temp_path), "%s.tmp", destination_path);
+
+  destination = fopen(temp_path, "w");
+
+  if(destination == NULL)
+  {
+    fclose(source);
+    return -1;
+  }
+
+  memset(&new_header, 0, sizeof(new_header));
+  new_header.magic = MOTB_MAGIC;
+  new_header.version = MOTB_VERSION;
+  new_header.node_id = nodeid;
+  new_header.checksum = MOTB_CHECKSUM_INIT;
+  MotbTimeEncoderReset(&time_encoder);
+
+  // l'intestazione viene riscritta alla fine, con i totali
+  if(fwrite(&new_header, sizeof(new_header), 1, destination) != 1)
+    result = -1;
+
+  while((result == 0) && ((read = getline(&line, &len, source)) != -1))
+  {
+    line_number++;
+
+    line_status = LineParse(line, line + read - ((line[read - 1] == '\n') ? 1 : 0),
+        &line_record);
+
+    if(line_status == LINE_EMPTY)
+      continue;
+
+    if(new_header.node_id == 0)
+      new_header.node_id = line_record.nodeid;
+
+    if((line_status != LINE_OK) || (line_record.type != 'S')
+        || (line_record.nodeid != new_header.node_id))
+    {
+      result = line_number;
+      break;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.position = line_record.position;
+    MotbTimeEncode(&time_encoder, line_record.time_ms, &record.time_value, &record.time_period);
+    record.time_residual = time_encoder.residual_ms;
+
+    if(fwrite(&record, sizeof(record), 1, destination) != 1)
+    {
+      result = -1;
+      break;
+    }
+
+    new_header.checksum = MotbChecksum(new_header.checksum, &record, sizeof(record));
+    new_header.point_count++;
+    new_header.total_time_ms += line_record.time_ms;
+  }
+
+  free(line);
+  fclose(source);
+
+  if(result == 0)
+  {
+    rewind(destination);
+
+    if(fwrite(&new_header, sizeof(new_header), 1, destination) != 1)
+      result = -1;
+  }
+
+  if(fclose(destination) != 0)
+    result = -1;
+
+  if((result == 0) && (rename(temp_path, destination_path) != 0))
+    result = -1;
+
+  if(result != 0)
+    remove(temp_path);
+  else if(header != NULL)
+    memcpy(header, &new_header, sizeof(new_header));
+
+  return result;
+}
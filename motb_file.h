@@ -0,0 +1,69 @@
+/*
+ * motb_file.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Formato binario compilato dei file tabella (.motb).
+ */
+
+#ifndef MOTB_FILE_H_
+#define MOTB_FILE_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define MOTB_MAGIC 0x42544F4D // "MOTB" letto in little endian
+#define MOTB_VERSION 2 // 2: tempi codificati con recupero dell'errore (vedi MotbTimeEncode)
+#define MOTB_EXTENSION ".motb"
+
+/**
+ * Intestazione del file .motb.
+ *
+ * @remark: i campi sono scritti nell'ordine dei byte della macchina che ha
+ * eseguito la conversione; un magic number non corrispondente indica un file
+ * generato su un'architettura diversa oppure non valido.
+ */
+struct motb_header
+{
+  uint32_t magic; /**< MOTB_MAGIC */
+  uint16_t version; /**< MOTB_VERSION */
+  uint16_t node_id; /**< indirizzo del motore */
+  uint32_t point_count; /**< numero di record presenti dopo l'intestazione */
+  uint32_t checksum; /**< FNV-1a a 32 bit calcolato su tutti i record */
+  uint64_t total_time_ms; /**< somma dei tempi di tutti i punti in ms */
+} __attribute__((packed));
+
+/**
+ * Record di un punto della tabella, con il tempo già codificato nel formato
+ * dell'interpolatore (valore * 10^periodo secondi).
+ */
+struct motb_record
+{
+  int32_t position; /**< posizione da raggiungere in passi encoder */
+  uint8_t time_value; /**< unità di tempo (0x60C2 sub1) */
+  int8_t time_period; /**< esponente del tempo (0x60C2 sub2) */
+  int16_t time_residual; /**< tempo richiesto meno tempo codificato fino a questo punto, in ms */
+} __attribute__((packed));
+
+/**
+ * Stato della codifica dei tempi di una tabella: l'errore di arrotondamento di
+ * ogni punto viene recuperato nel punto successivo.
+ */
+struct motb_time_encoder
+{
+  long residual_ms; /**< tempo richiesto meno tempo codificato, da aggiungere al prossimo punto */
+  long source_ms; /**< somma dei tempi richiesti */
+  long encoded_ms; /**< somma dei tempi codificati */
+};
+
+void MotbTimeEncoderReset(struct motb_time_encoder *encoder);
+long MotbTimeEncode(struct motb_time_encoder *encoder, long time_ms, uint8_t *time_value,
+    int8_t *time_period);
+long MotbTimeDecode(uint8_t time_value, int8_t time_period);
+uint32_t MotbChecksum(uint32_t checksum, const void *data, size_t size);
+int MotbHeaderRead(FILE *file, int nodeid, struct motb_header *header);
+int MotbConvert(const char *source_path, const char *destination_path, int nodeid,
+    struct motb_header *header);
+
+#endif /* MOTB_FILE_H_ */
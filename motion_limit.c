@@ -0,0 +1,275 @@
+/*
+ * motion_limit.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * I punti della tabella arrivavano al motore senza alcun controllo: un salto
+ * di posizione si scopriva solo dopo, con CERR_InterpInvalidPositionError o
+ * con l'errore di inseguimento segnalato dal motore.
+ *
+ * Qui i punti vengono controllati quando sono ancora nel buffer circolare,
+ * prima di essere inviati: per ogni segmento si ricava la velocità dalla
+ * differenza di posizione e dal tempo, e l'accelerazione dalla differenza di
+ * velocità con il segmento precedente. Il controllo va avanti fin dove è
+ * arrivato il riempitore, quindi un punto fuori dai limiti viene trovato con
+ * l'anticipo dell'intero buffer; i punti che lo precedono possono essere
+ * inviati, lui e quelli successivi no. Ogni punto viene controllato una volta
+ * sola, con poche operazioni intere.
+ */
+#include <string.h>
+#include "motion_limit.h"
+#include "CANOpenShellStateMachine.h"
+
+/**
+ * Stato del controllo per un motore.
+ */
+struct motion_limit_node
+{
+  long position; /**< posizione dell'ultimo punto controllato */
+  long long velocity; /**< velocità dell'ultimo segmento controllato, in passi/s */
+  long time_ms; /**< durata dell'ultimo segmento controllato */
+  int checked; /**< punti controllati oltre il puntatore di lettura del buffer */
+  int violation_offset; /**< posizione nel buffer del punto fuori dai limiti, -1 se nessuno */
+  int violation_reported; /**< il punto fuori dai limiti è già stato segnalato */
+  struct motion_limit_stats stats;
+
+  pthread_mutex_t mutex; /**< tra il thread che invia i punti ed i comandi */
+};
+
+static struct motion_limit_node limit_node[CANOPEN_NODE_NUMBER];
+static pthread_once_t limit_once = PTHREAD_ONCE_INIT;
+
+static void motion_limit_mutex_init(void)
+{
+  int i;
+
+  for(i = 0; i < CANOPEN_NODE_NUMBER; i++)
+    pthread_mutex_init(&limit_node[i].mutex, NULL);
+}
+
+static struct motion_limit_node *motion_limit_lock(int nodeid)
+{
+  if((nodeid < 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return NULL;
+
+  pthread_once(&limit_once, motion_limit_mutex_init);
+
+  pthread_mutex_lock(&limit_node[nodeid].mutex);
+
+  return &limit_node[nodeid];
+}
+
+/**
+ * Azzera lo stato e le statistiche del motore, da chiamare dopo QueueInit e
+ * prima di inviare la tabella. I limiti rimangono quelli impostati.
+ *
+ * @input position: posizione di partenza del motore, considerato fermo
+ */
+void motion_limit_reset(int nodeid, long position)
+{
+  struct motion_limit_node *node = motion_limit_lock(nodeid);
+  unsigned long max_velocity;
+  unsigned long max_acceleration;
+
+  if(node == NULL)
+    return;
+
+  max_velocity = node->stats.max_velocity;
+  max_acceleration = node->stats.max_acceleration;
+
+  node->position = position;
+  node->velocity = 0;
+  node->time_ms = 0;
+  node->checked = 0;
+  node->violation_offset = -1;
+  node->violation_reported = 0;
+
+  memset(&node->stats, 0, sizeof(node->stats));
+  node->stats.max_velocity = max_velocity;
+  node->stats.max_acceleration = max_acceleration;
+  node->stats.violation_point = -1;
+
+  pthread_mutex_unlock(&node->mutex);
+}
+
+/**
+ * Imposta i limiti del motore, 0 per disabilitare il controllo.
+ *
+ * @input max_velocity: velocità massima in passi/s
+ * @input max_acceleration: accelerazione massima in passi/s^2
+ *
+ * @return:  0 -> limiti impostati
+ *          -1 -> motore non valido
+ *
+ * @remark: i limiti valgono per i punti non ancora controllati.
+ */
+int motion_limit_configure(int nodeid, unsigned long max_velocity, unsigned long max_acceleration)
+{
+  struct motion_limit_node *node = motion_limit_lock(nodeid);
+
+  if(node == NULL)
+    return -1;
+
+  node->stats.max_velocity = max_velocity;
+  node->stats.max_acceleration = max_acceleration;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return 0;
+}
+
+/**
+ * Controlla un segmento, dal punto precedente a quello indicato.
+ *
+ * @return: MOTION_LIMIT_xxx
+ */
+static int motion_limit_segment(struct motion_limit_node *node, long position, long time_ms)
+{
+  long long velocity;
+  unsigned long long acceleration;
+  unsigned long long speed;
+  long long delta = (long long) position - node->position;
+
+  if(time_ms <= 0)
+  {
+    // un punto a tempo nullo può solo ripetere la posizione
+    if(delta != 0)
+      return MOTION_LIMIT_VELOCITY;
+
+    return MOTION_LIMIT_OK;
+  }
+
+  velocity = delta * 1000 / time_ms;
+  speed = (velocity < 0) ? -velocity : velocity;
+
+  // accelerazione a cavallo dei due segmenti, riferita ai loro punti medi
+  acceleration = (velocity > node->velocity) ? velocity - node->velocity : node->velocity - velocity;
+  acceleration = acceleration * 2000 / (node->time_ms + time_ms);
+
+  if(speed > node->stats.peak_velocity)
+    node->stats.peak_velocity = speed;
+
+  if(acceleration > node->stats.peak_acceleration)
+    node->stats.peak_acceleration = acceleration;
+
+  if((node->stats.max_velocity != 0) && (speed > node->stats.max_velocity))
+    return MOTION_LIMIT_VELOCITY;
+
+  if((node->stats.max_acceleration != 0) && (acceleration > node->stats.max_acceleration))
+    return MOTION_LIMIT_ACCELERATION;
+
+  node->position = position;
+  node->velocity = velocity;
+  node->time_ms = time_ms;
+
+  return MOTION_LIMIT_OK;
+}
+
+/**
+ * Controlla i punti arrivati nel buffer dall'ultima chiamata.
+ *
+ * @input table: buffer circolare del motore
+ * @output violation: MOTION_LIMIT_xxx del punto fuori dai limiti, solo la prima
+ * volta che viene trovato, altrimenti MOTION_LIMIT_OK
+ *
+ * @return: numero di punti, a partire dal puntatore di lettura, che possono
+ * essere inviati
+ *
+ * @remark: va chiamata solo dal consumatore del buffer, come QueueGet; dopo
+ * QueueUpdate bisogna chiamare motion_limit_consumed.
+ */
+int motion_limit_check(int nodeid, struct table_data *table, int *violation)
+{
+  struct motion_limit_node *node = motion_limit_lock(nodeid);
+  struct table_data_read data_read;
+  int point_count;
+  int get_result;
+  int result;
+
+  *violation = MOTION_LIMIT_OK;
+
+  if(node == NULL)
+    return 0;
+
+  point_count = QueueCount(table);
+
+  while((node->violation_offset < 0) && (node->checked < point_count))
+  {
+    get_result = QueueGet(table, &data_read, node->checked);
+
+    // fine della tabella
+    if(get_result == -2)
+      break;
+
+    // i punti non validi vengono saltati anche da chi invia
+    if(get_result == 0)
+    {
+      result = motion_limit_segment(node, data_read.position, data_read.time_ms);
+
+      if(result != MOTION_LIMIT_OK)
+      {
+        node->violation_offset = node->checked;
+        node->stats.violation = result;
+        node->stats.violation_point = node->stats.point_count;
+        break;
+      }
+
+      node->stats.point_count++;
+    }
+
+    node->checked++;
+  }
+
+  if(node->violation_offset >= 0)
+  {
+    point_count = node->violation_offset;
+
+    if(node->violation_reported == 0)
+    {
+      node->violation_reported = 1;
+      *violation = node->stats.violation;
+    }
+  }
+  else
+    point_count = node->checked;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return point_count;
+}
+
+/**
+ * Segnala che point_count punti sono stati tolti dal buffer con QueueUpdate.
+ */
+void motion_limit_consumed(int nodeid, int point_count)
+{
+  struct motion_limit_node *node = motion_limit_lock(nodeid);
+
+  if(node == NULL)
+    return;
+
+  node->checked -= point_count;
+
+  if(node->checked < 0)
+    node->checked = 0;
+
+  if(node->violation_offset >= 0)
+    node->violation_offset -= point_count;
+
+  pthread_mutex_unlock(&node->mutex);
+}
+
+int motion_limit_stats_get(int nodeid, struct motion_limit_stats *stats)
+{
+  struct motion_limit_node *node = motion_limit_lock(nodeid);
+
+  if(node == NULL)
+    return -1;
+
+  *stats = node->stats;
+
+  pthread_mutex_unlock(&node->mutex);
+
+  return 0;
+}
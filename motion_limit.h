@@ -0,0 +1,42 @@
+/*
+ * motion_limit.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Controllo anticipato dei limiti di velocità ed accelerazione sui punti della
+ * tabella.
+ */
+
+#ifndef MOTION_LIMIT_H_
+#define MOTION_LIMIT_H_
+
+#include <stdio.h>
+#include <pthread.h>
+#include "file_parser.h"
+
+#define MOTION_LIMIT_OK 0
+#define MOTION_LIMIT_VELOCITY 1 // velocità del segmento oltre il limite
+#define MOTION_LIMIT_ACCELERATION 2 // variazione di velocità tra due segmenti oltre il limite
+
+/**
+ * Limiti e statistiche di un motore, dall'ultimo avvio della simulazione.
+ */
+struct motion_limit_stats
+{
+  unsigned long max_velocity; /**< limite di velocità in passi/s, 0 se disabilitato */
+  unsigned long max_acceleration; /**< limite di accelerazione in passi/s^2, 0 se disabilitato */
+  unsigned long peak_velocity; /**< velocità più alta incontrata */
+  unsigned long peak_acceleration; /**< accelerazione più alta incontrata */
+  unsigned long point_count; /**< punti controllati */
+  int violation; /**< MOTION_LIMIT_xxx del primo punto fuori dai limiti */
+  long violation_point; /**< indice del primo punto fuori dai limiti, -1 se nessuno */
+};
+
+void motion_limit_reset(int nodeid, long position);
+int motion_limit_configure(int nodeid, unsigned long max_velocity, unsigned long max_acceleration);
+int motion_limit_check(int nodeid, struct table_data *table, int *violation);
+void motion_limit_consumed(int nodeid, int point_count);
+int motion_limit_stats_get(int nodeid, struct motion_limit_stats *stats);
+
+#endif /* MOTION_LIMIT_H_ */
@@ -0,0 +1,183 @@
+/*
+ * sdo_stats.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * La durata di CT0 e CT2 dipende quasi solo dai trasferimenti SDO delle
+ * macchine a stati, ma finora non c'era modo di sapere quali passi pesassero
+ * di più.
+ *
+ * Qui viene registrato il tempo di ogni trasferimento, dall'invio della
+ * richiesta alla risposta del motore, sia per motore che per oggetto del
+ * dizionario: il primo mostra i motori lenti, il secondo i registri lenti
+ * (per esempio le scritture che fanno salvare la configurazione al motore).
+ * Gli oggetti vengono registrati nell'ordine in cui compaiono, fino a
+ * SDO_STATS_INDEX_SIZE; i successivi vengono contati solo per motore.
+ *
+ * Vengono contati anche i timeout ed i passi ripetuti: un motore che li
+ * accumula rallenta le proprie sequenze, ma non blocca più gli altri.
+ */
+#include <string.h>
+#include <pthread.h>
+#include "sdo_stats.h"
+#include "CANOpenShellStateMachine.h"
+
+static struct sdo_stats node_stats[CANOPEN_NODE_NUMBER];
+static unsigned int index_list[SDO_STATS_INDEX_SIZE];
+static struct sdo_stats index_stats[SDO_STATS_INDEX_SIZE];
+static int index_count = 0;
+
+static pthread_mutex_t stats_mux = PTHREAD_MUTEX_INITIALIZER;
+
+static void sdo_stats_add(struct sdo_stats *stats, unsigned long elapsed_us, int error)
+{
+  stats->transfer_count++;
+
+  if(error)
+    stats->error_count++;
+
+  stats->total_us += elapsed_us;
+  stats->last_us = elapsed_us;
+
+  if(elapsed_us > stats->max_us)
+    stats->max_us = elapsed_us;
+}
+
+void sdo_stats_reset(void)
+{
+  pthread_mutex_lock(&stats_mux);
+
+  memset(node_stats, 0, sizeof(node_stats));
+  memset(index_stats, 0, sizeof(index_stats));
+  index_count = 0;
+
+  pthread_mutex_unlock(&stats_mux);
+}
+
+/**
+ * Cerca l'oggetto tra quelli registrati, aggiungendolo se c'è posto. Va
+ * chiamata con stats_mux.
+ *
+ * @return: statistiche dell'oggetto, NULL se la tabella è piena
+ */
+static struct sdo_stats *sdo_stats_index(unsigned int index)
+{
+  int i;
+
+  for(i = 0; i < index_count; i++)
+  {
+    if(index_list[i] == index)
+      return &index_stats[i];
+  }
+
+  if(index_count == SDO_STATS_INDEX_SIZE)
+    return NULL;
+
+  index_list[index_count] = index;
+  memset(&index_stats[index_count], 0, sizeof(index_stats[index_count]));
+
+  return &index_stats[index_count++];
+}
+
+/**
+ * Registra un trasferimento concluso.
+ *
+ * @input index: oggetto del dizionario
+ * @input elapsed_us: tempo dall'invio della richiesta alla risposta
+ * @input error: diverso da 0 se il trasferimento si è concluso con errore
+ */
+void sdo_stats_transfer(int nodeid, unsigned int index, unsigned long elapsed_us, int error)
+{
+  struct sdo_stats *stats;
+
+  if((nodeid < 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return;
+
+  pthread_mutex_lock(&stats_mux);
+
+  sdo_stats_add(&node_stats[nodeid], elapsed_us, error);
+
+  stats = sdo_stats_index(index);
+
+  if(stats != NULL)
+    sdo_stats_add(stats, elapsed_us, error);
+
+  pthread_mutex_unlock(&stats_mux);
+}
+
+void sdo_stats_timeout(int nodeid, unsigned int index)
+{
+  struct sdo_stats *stats;
+
+  if((nodeid < 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return;
+
+  pthread_mutex_lock(&stats_mux);
+
+  node_stats[nodeid].timeout_count++;
+
+  stats = sdo_stats_index(index);
+
+  if(stats != NULL)
+    stats->timeout_count++;
+
+  pthread_mutex_unlock(&stats_mux);
+}
+
+void sdo_stats_retry(int nodeid, unsigned int index)
+{
+  struct sdo_stats *stats;
+
+  if((nodeid < 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return;
+
+  pthread_mutex_lock(&stats_mux);
+
+  node_stats[nodeid].retry_count++;
+
+  stats = sdo_stats_index(index);
+
+  if(stats != NULL)
+    stats->retry_count++;
+
+  pthread_mutex_unlock(&stats_mux);
+}
+
+int sdo_stats_node_get(int nodeid, struct sdo_stats *stats)
+{
+  if((nodeid < 0) || (nodeid >= CANOPEN_NODE_NUMBER))
+    return -1;
+
+  pthread_mutex_lock(&stats_mux);
+  *stats = node_stats[nodeid];
+  pthread_mutex_unlock(&stats_mux);
+
+  return 0;
+}
+
+/**
+ * Restituisce le statistiche dell'oggetto registrato in posizione position.
+ *
+ * @output index: oggetto del dizionario
+ *
+ * @return:  0 -> oggetto restituito
+ *          -1 -> non ci sono altri oggetti registrati
+ */
+int sdo_stats_index_get(int position, unsigned int *index, struct sdo_stats *stats)
+{
+  int result_value = -1;
+
+  pthread_mutex_lock(&stats_mux);
+
+  if((position >= 0) && (position < index_count))
+  {
+    *index = index_list[position];
+    *stats = index_stats[position];
+    result_value = 0;
+  }
+
+  pthread_mutex_unlock(&stats_mux);
+
+  return result_value;
+}
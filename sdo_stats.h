@@ -0,0 +1,38 @@
+/*
+ * sdo_stats.h
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Tempi dei trasferimenti SDO delle macchine a stati, per motore e per oggetto
+ * del dizionario.
+ */
+
+#ifndef SDO_STATS_H_
+#define SDO_STATS_H_
+
+#define SDO_STATS_INDEX_SIZE 64 // oggetti del dizionario distinti registrati
+
+/**
+ * Trasferimenti SDO di un motore o di un oggetto, dall'avvio o dall'ultimo
+ * azzeramento.
+ */
+struct sdo_stats
+{
+  unsigned long transfer_count; /**< trasferimenti conclusi, anche con errore */
+  unsigned long error_count; /**< trasferimenti conclusi con errore */
+  unsigned long long total_us; /**< somma dei tempi dalla richiesta alla risposta */
+  unsigned long max_us; /**< tempo più lungo */
+  unsigned long last_us; /**< tempo dell'ultimo trasferimento */
+  unsigned long timeout_count; /**< risposte non arrivate entro il timeout del passo */
+  unsigned long retry_count; /**< passi ripetuti dopo un timeout o un abort */
+};
+
+void sdo_stats_reset(void);
+void sdo_stats_transfer(int nodeid, unsigned int index, unsigned long elapsed_us, int error);
+void sdo_stats_timeout(int nodeid, unsigned int index);
+void sdo_stats_retry(int nodeid, unsigned int index);
+int sdo_stats_node_get(int nodeid, struct sdo_stats *stats);
+int sdo_stats_index_get(int position, unsigned int *index, struct sdo_stats *stats);
+
+#endif /* SDO_STATS_H_ */
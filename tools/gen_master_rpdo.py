@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+#
+# gen_master_rpdo.py
+#
+#  Created on: 17/ott/2026
+#      Author: luca
+#
+# Rigenera i PDO di ricezione del dizionario del master (CANOpenShellMasterOD.od
+# e CANOpenShellMasterOD.c) per il numero di motori indicato.
+#
+# Ogni motore usa tre PDO di ricezione, divisi in tre gruppi consecutivi della
+# stessa dimensione: stato (0x180), posizione (0x280) e stato CAN (0x380). Il
+# programma assegna il PDO di ogni gruppo alla tabella del motore e ne scrive
+# il COB-ID all'avvio del motore (vedi MotorSlotAssign), per cui qui basta
+# crearne il numero giusto.
+#
+# I primi sei motori mantengono i COB-ID predefiniti degli indirizzi 0x77-0x7C;
+# i PDO degli altri partono disabilitati (bit 31) finché non vengono assegnati.
+#
+# objdictgen/gen_cfile.py non viene usato perché è più vecchio della versione
+# di CanFestival con cui è stato generato CANOpenShellMasterOD.c (firma di
+# scanIndexOD diversa): lo script modifica solo le parti relative ai PDO di
+# ricezione e ricalcola gli indici che ne dipendono.
+#
+# Uso: tools/gen_master_rpdo.py <motori> [CANOpenShellMasterOD]
+#
+
+import re
+import sys
+
+PREFIX = "CANOpenShellMasterOD"
+TABLE_MAX_NUM = 24 # vedi CANOpenShell.h
+
+LEGACY_SLOT = 6
+LEGACY_NODEID = 0x77
+
+# gruppi di PDO di ricezione per motore: COB-ID base ed oggetti mappati
+GROUPS = [
+  (0x180, [0x20000008, 0x60410010, 0x24000010, 0x60610008]), # node id, statusword, interpolation status, modes of operation display
+  (0x280, [0x20000008, 0x60630020]), # node id, position actual value
+  (0x380, [0x20000008, 0x23040110, 0x23040310]), # node id, stato CAN
+]
+
+# intervalli degli indici usati da quick_index, nell'ordine della struttura
+QUICK_INDEX = [
+  ("SDO_SVR", 0x1200, 0x127F),
+  ("SDO_CLT", 0x1280, 0x12FF),
+  ("PDO_RCV", 0x1400, 0x15FF),
+  ("PDO_RCV_MAP", 0x1600, 0x17FF),
+  ("PDO_TRS", 0x1800, 0x19FF),
+  ("PDO_TRS_MAP", 0x1A00, 0x1BFF),
+]
+
+
+def rpdo_list(motors):
+  """Restituisce per ogni PDO di ricezione il COB-ID e gli oggetti mappati."""
+  rpdo = []
+
+  for base, mapping in GROUPS:
+    for slot in range(motors):
+      if slot < LEGACY_SLOT:
+        cob_id = base + LEGACY_NODEID + slot
+      else:
+        cob_id = 0x80000000 + base
+
+      rpdo.append((cob_id, mapping))
+
+  return rpdo
+
+
+def c_parameter(index, number, cob_id):
+  name = "%s_obj%04X" % (PREFIX, index)
+
+  return ("/* index 0x%04X :   Receive PDO %d Parameter. */\n" % (index, number)
+      + "                    UNS8 %s_highestSubIndex_obj%04X = 6; /* number of subindex - 1*/\n" % (PREFIX, index)
+      + "                    UNS32 %s_COB_ID_used_by_PDO = 0x%X;\t/* %d */\n" % (name, cob_id, cob_id)
+      + "                    UNS8 %s_Transmission_Type = 0xFF;\t/* 255 */\n" % name
+      + "                    UNS16 %s_Inhibit_Time = 0x0;\t/* 0 */\n" % name
+      + "                    UNS8 %s_Compatibility_Entry = 0x0;\t/* 0 */\n" % name
+      + "                    UNS16 %s_Event_Timer = 0x0;\t/* 0 */\n" % name
+      + "                    UNS8 %s_SYNC_start_value = 0x0;\t/* 0 */\n" % name
+      + "                    subindex %s_Index%04X[] = \n" % (PREFIX, index)
+      + "                     {\n"
+      + "                       { RO, uint8, sizeof (UNS8), (void*)&%s_highestSubIndex_obj%04X, NULL },\n" % (PREFIX, index)
+      + "                       { RW, uint32, sizeof (UNS32), (void*)&%s_COB_ID_used_by_PDO, NULL },\n" % name
+      + "                       { RW, uint8, sizeof (UNS8), (void*)&%s_Transmission_Type, NULL },\n" % name
+      + "                       { RW, uint16, sizeof (UNS16), (void*)&%s_Inhibit_Time, NULL },\n" % name
+      + "                       { RW, uint8, sizeof (UNS8), (void*)&%s_Compatibility_Entry, NULL },\n" % name
+      + "                       { RW, uint16, sizeof (UNS16), (void*)&%s_Event_Timer, NULL },\n" % name
+      + "                       { RW, uint8, sizeof (UNS8), (void*)&%s_SYNC_start_value, NULL }\n" % name
+      + "                     };\n\n")
+
+
+def c_mapping(index, number, mapping):
+  name = "%s_obj%04X" % (PREFIX, index)
+  text = ("/* index 0x%04X :   Receive PDO %d Mapping. */\n" % (index, number)
+      + "                    UNS8 %s_highestSubIndex_obj%04X = %d; /* number of subindex - 1*/\n"
+      % (PREFIX, index, len(mapping))
+      + "                    UNS32 %s[] = \n" % name
+      + "                    {\n")
+  lines = []
+
+  for i, value in enumerate(mapping):
+    separator = "," if i < len(mapping) - 1 else ""
+    lines.append("                      0x%X%s\t/* %d */" % (value, separator, value))
+
+  text += "\n".join(lines) + "\n"
+  text += ("                    };\n"
+      + "                    subindex %s_Index%04X[] = \n" % (PREFIX, index)
+      + "                     {\n"
+      + "                       { RW, uint8, sizeof (UNS8), (void*)&%s_highestSubIndex_obj%04X, NULL },\n" % (PREFIX, index))
+
+  lines = []
+
+  for i in range(len(mapping)):
+    separator = "," if i < len(mapping) - 1 else ""
+    lines.append("                       { RW, uint32, sizeof (UNS32), (void*)&%s[%d], NULL }%s" % (name, i, separator))
+
+  text += "\n".join(lines) + "\n"
+  text += "                     };\n\n"
+
+  return text
+
+
+def objdict_line(index):
+  name = "%s_Index%04X" % (PREFIX, index)
+
+  return "  { (subindex*)%s,sizeof(%s)/sizeof(%s[0]), 0x%04X},\n" % (name, name, name, index)
+
+
+def generate_c(path, motors):
+  text = open(path).read()
+  rpdo = rpdo_list(motors)
+
+  # definizioni degli oggetti
+  start = text.index("/* index 0x1400 :")
+  end = text.index("/* index 0x1800 :")
+  blocks = ""
+
+  for i, (cob_id, mapping) in enumerate(rpdo):
+    blocks += c_parameter(0x1400 + i, i + 1, cob_id)
+
+  for i, (cob_id, mapping) in enumerate(rpdo):
+    blocks += c_mapping(0x1600 + i, i + 1, mapping)
+
+  text = text[:start] + blocks + text[end:]
+
+  # tabella degli oggetti
+  objdict_re = re.compile(r"^  \{ \(subindex\*\)%s_Index([0-9A-F]{4}),.*\n" % PREFIX, re.M)
+  entries = objdict_re.findall(text)
+  first = objdict_re.search(text)
+  last = list(objdict_re.finditer(text))[-1]
+
+  index_list = [int(index, 16) for index in entries if not 0x1400 <= int(index, 16) <= 0x17FF]
+  index_list += [0x1400 + i for i in range(len(rpdo))] + [0x1600 + i for i in range(len(rpdo))]
+  index_list.sort()
+
+  objdict = "".join(objdict_line(index) for index in index_list)
+  text = text[:first.start()] + objdict + text[last.end():]
+
+  # ricerca degli oggetti
+  case_re = re.compile(r"^\t\tcase 0x([0-9A-F]{4}): i = \d+;break;\n", re.M)
+  first = case_re.search(text)
+  last = list(case_re.finditer(text))[-1]
+  cases = "".join("\t\tcase 0x%04X: i = %d;break;\n" % (index, i) for i, index in enumerate(index_list))
+  text = text[:first.start()] + cases + text[last.end():]
+
+  # indici rapidi
+  for name, low, high in QUICK_INDEX:
+    position = [i for i, index in enumerate(index_list) if low <= index <= high]
+
+    # senza oggetti dell'intervallo il generatore lascia 0
+    if not position:
+      continue
+
+    for struct, value in (("firstIndex", position[0]), ("lastIndex", position[-1])):
+      block_re = re.compile(r"(const quick_index %s_%s = \{.*?)(\d+)(,? /\* %s \*/)" % (PREFIX, struct, name), re.S)
+      text = block_re.sub(lambda m: m.group(1) + str(value) + m.group(3), text, count=1)
+
+  open(path, "w").write(text)
+
+
+def od_entry(key, values, next_id):
+  text = "  <entry>\n"
+  text += "    <key type=\"numeric\" value=\"%d\" />\n" % key
+  text += "    <val type=\"list\" id=\"%d\" >\n" % next_id
+
+  for value in values:
+    text += "      <item type=\"numeric\" value=\"%d\" />\n" % value
+
+  text += "    </val>\n"
+  text += "  </entry>\n"
+
+  return text
+
+
+def generate_od(path, motors):
+  text = open(path).read()
+  rpdo = rpdo_list(motors)
+
+  start = text.index("<attr name=\"Dictionary\"")
+  start = text.index("\n", start) + 1
+  end = text.index("</attr>", start)
+  dictionary = text[start:end]
+
+  entry_re = re.compile(r"  <entry>\n    <key type=\"numeric\" value=\"(\d+)\" />\n.*?\n  </entry>\n", re.S)
+
+  def keep(match):
+    return "" if 0x1400 <= int(match.group(1)) <= 0x17FF else match.group(0)
+
+  dictionary = entry_re.sub(keep, dictionary)
+
+  next_id = max(int(value) for value in re.findall(r"id=\"(\d+)\"", text)) + 1
+
+  for i, (cob_id, mapping) in enumerate(rpdo):
+    dictionary += od_entry(0x1400 + i, [cob_id, 0xFF, 0, 0, 0, 0], next_id)
+    dictionary += od_entry(0x1600 + i, mapping, next_id + 1)
+    next_id += 2
+
+  text = text[:start] + dictionary + text[end:]
+
+  open(path, "w").write(text)
+
+
+def main():
+  if len(sys.argv) < 2:
+    print("Uso: %s <motori> [%s]" % (sys.argv[0], PREFIX))
+    return 1
+
+  motors = int(sys.argv[1])
+  base = sys.argv[2] if len(sys.argv) > 2 else PREFIX
+
+  # 0x1400-0x15FF: al più 512 PDO di ricezione
+  if (motors < 1) or (motors > TABLE_MAX_NUM):
+    print("Il numero di motori deve essere tra 1 e %d (TABLE_MAX_NUM)" % TABLE_MAX_NUM)
+    return 1
+
+  generate_od(base + ".od", motors)
+  generate_c(base + ".c", motors)
+
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())
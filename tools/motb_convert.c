@@ -0,0 +1,67 @@
+/*
+ * motb_convert.c
+ *
+ *  Created on: 17/ott/2026
+ *      Author: luca
+ *
+ * Converte i file tabella .mot (o .mot.fake) nel formato binario .motb
+ * letto dal riempitore di tabella.
+ *
+ * Uso: motb_convert <file.mot> [file.motb]
+ *
+ * Se il file di destinazione non viene indicato, viene generato accanto al
+ * sorgente sostituendo ".mot" con ".motb" (es. 119.mot.fake -> 119.motb.fake).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../motb_file.h"
+
+int main(int argc, char **argv)
+{
+  char destination_path[512];
+  struct motb_header header;
+  char *extension;
+  int result;
+
+  if((argc < 2) || (argc > 3))
+  {
+    printf("Uso: %s <file.mot> [file.motb]\n", argv[0]);
+    return 1;
+  }
+
+  if(argc == 3)
+    snprintf(destination_path, sizeof(destination_path), "%s", argv[2]);
+  else
+  {
+    extension = strstr(argv[1], ".mot");
+
+    if(extension == NULL)
+    {
+      printf("ERR: il file %s non ha estensione .mot\n", argv[1]);
+      return 1;
+    }
+
+    snprintf(destination_path, sizeof(destination_path), "%.*s%s%s",
+        (int) (extension - argv[1]), argv[1], MOTB_EXTENSION, extension + strlen(".mot"));
+  }
+
+  result = MotbConvert(argv[1], destination_path, 0, &header);
+
+  if(result < 0)
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  else if(result > 0)
+  {
+    printf("ERR: riga %d non valida in %s\n", result, argv[1]);
+    return 1;
+  }
+
+  printf("%s: motore %d, %u punti, durata %llu ms, checksum %08x\n", destination_path,
+      header.node_id, header.point_count, (unsigned long long) header.total_time_ms,
+      header.checksum);
+
+  return 0;
+}